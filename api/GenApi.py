@@ -211,6 +211,43 @@ def ivectordouble(name, value=None, python_value=None, julia_value=None):
     return a
 
 
+def ibuffer(name, cpp_type, c_type, python_type, julia_type, fortran_type,
+            fortran_size, texi_type):
+    # caller-allocated buffer of fixed size, filled in place by the function
+    # (no intermediate copy in the C API and the bindings)
+    a = arg(name, None, None, None, cpp_type + " *", c_type + " *", False)
+    api_name = "api_" + name + "_"
+    api_name_n = "api_" + name + "_n_"
+    a.cpp = (cpp_type + " * " + name + ", const std::size_t " + name + "_n")
+    a.c = c_type + " * " + name + ", const size_t " + name + "_n"
+    a.c_arg = name + ", " + name + "_n"
+    a.cwrap_arg = name + ", " + name + "_n"
+    a.python_pre = (api_name + ", " + api_name_n + " = _ibuffer(" + name +
+                    ", " + python_type + ")")
+    a.python_arg = api_name + ", " + api_name_n
+    a.julia_ctype = "Ptr{" + julia_type + "}, Csize_t"
+    a.julia_arg = name + ", length(" + name + ")"
+    a.fortran_args = [name]
+    a.fortran_types = [fortran_type + ", dimension(:), intent(inout)"]
+    a.fortran_c_api = [fortran_type + ", dimension(*)",
+                       "integer(c_size_t), value, intent(in)"]
+    a.fortran_c_args = [api_name, api_name_n]
+    a.fortran_call = (f"{api_name}={name}, &{api_name_n}=" +
+                      f"{fortran_size}({name})")
+    a.texi_type = texi_type
+    return a
+
+
+def ibuffersize(name):
+    return ibuffer(name, "std::size_t", "size_t", "c_size_t", "Csize_t",
+                   "integer(c_size_t)", "size_gmsh_size", "buffer of sizes")
+
+
+def ibufferdouble(name):
+    return ibuffer(name, "double", "double", "c_double", "Cdouble",
+                   "real(c_double)", "size_gmsh_double", "buffer of doubles")
+
+
 def ivectorstring(name, value=None, python_value=None, julia_value=None):
     a = arg(name, value, python_value, julia_value,
             "const std::vector<std::string> &", "const char * const *", False)
@@ -1465,6 +1502,20 @@ def _ivectorpair(o):
             raise Exception("Invalid data for input vector of pairs")
         return ((c_int * 2) * len(o))(*o), c_size_t(len(o) * 2)
 
+def _ibuffer(o, ctype):
+    if use_numpy and isinstance(o, numpy.ndarray):
+        dtype = numpy.uintp if ctype is c_size_t else numpy.float64
+        if(o.dtype != dtype or o.ndim != 1 or not o.flags.c_contiguous or
+           not o.flags.writeable):
+            raise Exception("Invalid buffer: expected a writeable contiguous "
+                            "1D array of type " + numpy.dtype(dtype).name)
+        return o.ctypes.data_as(POINTER(ctype)), c_size_t(o.size)
+    elif isinstance(o, Array) and o._type_ is ctype:
+        return cast(o, POINTER(ctype)), c_size_t(len(o))
+    else:
+        raise Exception("Invalid buffer: expected a numpy array or a ctypes "
+                        "array")
+
 def _ivectorstring(o):
     return (c_char_p * len(o))(*(s.encode() for s in o)), c_size_t(len(o))
 
@@ -546,6 +546,10 @@ module gmsh
         gmshModelMeshAffineTransform
     procedure, nopass :: getNodes => &
         gmshModelMeshGetNodes
+    procedure, nopass :: getNumberOfNodes => &
+        gmshModelMeshGetNumberOfNodes
+    procedure, nopass :: getNodesInBuffers => &
+        gmshModelMeshGetNodesInBuffers
     procedure, nopass :: getNodesByElementType => &
         gmshModelMeshGetNodesByElementType
     procedure, nopass :: getNode => &
@@ -584,12 +588,18 @@ module gmsh
         gmshModelMeshGetElementProperties
     procedure, nopass :: getElementsByType => &
         gmshModelMeshGetElementsByType
+    procedure, nopass :: getNumberOfElementsByType => &
+        gmshModelMeshGetNumberOfElementsByType
+    procedure, nopass :: getElementsByTypeInBuffers => &
+        gmshModelMeshGetElementsByTypeInBuffers
     procedure, nopass :: getMaxElementTag => &
         gmshModelMeshGetMaxElementTag
     procedure, nopass :: preallocateElementsByType => &
         gmshModelMeshPreallocateElementsByType
     procedure, nopass :: getElementQualities => &
         gmshModelMeshGetElementQualities
+    procedure, nopass :: getElementQualitiesByType => &
+        gmshModelMeshGetElementQualitiesByType
     procedure, nopass :: addElements => &
         gmshModelMeshAddElements
     procedure, nopass :: addElementsByType => &
@@ -807,6 +817,8 @@ module gmsh
         gmshModelGetPartitions
     procedure, nopass :: getValue => &
         gmshModelGetValue
+    procedure, nopass :: getValueInBuffers => &
+        gmshModelGetValueInBuffers
     procedure, nopass :: getDerivative => &
         gmshModelGetDerivative
     procedure, nopass :: getSecondDerivative => &
@@ -825,6 +837,8 @@ module gmsh
         gmshModelIsInside
     procedure, nopass :: getClosestPoint => &
         gmshModelGetClosestPoint
+    procedure, nopass :: getClosestPointInBuffers => &
+        gmshModelGetClosestPointInBuffers
     procedure, nopass :: reparametrizeOnSurface => &
         gmshModelReparametrizeOnSurface
     procedure, nopass :: setVisibility => &
@@ -2214,7 +2228,8 @@ module gmsh
   !! parametric coordinates on the curve) or 2 (with `parametricCoord'
   !! containing u, v parametric coordinates on the surface, concatenated: [p1u,
   !! p1v, p2u, ...]). Return x, y, z coordinates in `coord', concatenated: [p1x,
-  !! p1y, p1z, p2x, ...].
+  !! p1y, p1z, p2x, ...]. The points are evaluated using `General.NumThreads'
+  !! threads.
   subroutine gmshModelGetValue(dim, &
                                tag, &
                                parametricCoord, &
@@ -2257,6 +2272,52 @@ module gmsh
       api_coord_n_)
   end subroutine gmshModelGetValue
 
+  !> Evaluate the parametrization of the entity of dimension `dim' and tag `tag'
+  !! at the parametric coordinates `parametricCoord' like `getValue', but write
+  !! the x, y, z coordinates directly into the caller-allocated buffer `coord',
+  !! of length at least 3 times the number of points. This avoids any
+  !! intermediate copy of the result, e.g. when evaluating many points in a loop
+  !! from the Python, Julia or Fortran bindings (where the buffer should be a
+  !! contiguous array of doubles, e.g. a numpy array of type `numpy.float64' in
+  !! Python). The points are evaluated using `General.NumThreads' threads.
+  subroutine gmshModelGetValueInBuffers(dim, &
+                                        tag, &
+                                        parametricCoord, &
+                                        coord, &
+                                        ierr)
+    interface
+    subroutine C_API(dim, &
+                     tag, &
+                     api_parametricCoord_, &
+                     api_parametricCoord_n_, &
+                     api_coord_, &
+                     api_coord_n_, &
+                     ierr_) &
+      bind(C, name="gmshModelGetValueInBuffers")
+      use, intrinsic :: iso_c_binding
+      integer(c_int), value, intent(in) :: dim
+      integer(c_int), value, intent(in) :: tag
+      real(c_double), dimension(*) :: api_parametricCoord_
+      integer(c_size_t), value, intent(in) :: api_parametricCoord_n_
+      real(c_double), dimension(*) :: api_coord_
+      integer(c_size_t), value, intent(in) :: api_coord_n_
+      integer(c_int), intent(out), optional :: ierr_
+    end subroutine C_API
+    end interface
+    integer, intent(in) :: dim
+    integer, intent(in) :: tag
+    real(c_double), dimension(:), intent(in) :: parametricCoord
+    real(c_double), dimension(:), intent(inout) :: coord
+    integer(c_int), intent(out), optional :: ierr
+    call C_API(dim=int(dim, c_int), &
+         tag=int(tag, c_int), &
+         api_parametricCoord_=parametricCoord, &
+         api_parametricCoord_n_=size_gmsh_double(parametricCoord), &
+         api_coord_=coord, &
+         api_coord_n_=size_gmsh_double(coord), &
+         ierr_=ierr)
+  end subroutine gmshModelGetValueInBuffers
+
   !> Evaluate the derivative of the parametrization of the entity of dimension
   !! `dim' and tag `tag' at the parametric coordinates `parametricCoord'. Only
   !! valid for `dim' equal to 1 (with `parametricCoord' containing parametric
@@ -2265,7 +2326,8 @@ module gmsh
   !! For `dim' equal to 1 return the x, y, z components of the derivative with
   !! respect to u [d1ux, d1uy, d1uz, d2ux, ...]; for `dim' equal to 2 return the
   !! x, y, z components of the derivative with respect to u and v: [d1ux, d1uy,
-  !! d1uz, d1vx, d1vy, d1vz, d2ux, ...].
+  !! d1uz, d1vx, d1vy, d1vz, d2ux, ...]. The points are evaluated using
+  !! `General.NumThreads' threads.
   subroutine gmshModelGetDerivative(dim, &
                                     tag, &
                                     parametricCoord, &
@@ -2318,7 +2380,8 @@ module gmsh
   !! d1uuz, d2uux, ...]; for `dim' equal to 2 return the x, y, z components of
   !! the second derivative with respect to u and v, and the mixed derivative
   !! with respect to u and v: [d1uux, d1uuy, d1uuz, d1vvx, d1vvy, d1vvz, d1uvx,
-  !! d1uvy, d1uvz, d2uux, ...].
+  !! d1uvy, d1uvz, d2uux, ...]. The points are evaluated using
+  !! `General.NumThreads' threads.
   subroutine gmshModelGetSecondDerivative(dim, &
                                           tag, &
                                           parametricCoord, &
@@ -2365,7 +2428,8 @@ module gmsh
   !! `tag' at the parametric coordinates `parametricCoord'. Only valid for `dim'
   !! equal to 1 (with `parametricCoord' containing parametric coordinates on the
   !! curve) or 2 (with `parametricCoord' containing u, v parametric coordinates
-  !! on the surface, concatenated: [p1u, p1v, p2u, ...]).
+  !! on the surface, concatenated: [p1u, p1v, p2u, ...]). The points are
+  !! evaluated using `General.NumThreads' threads.
   subroutine gmshModelGetCurvature(dim, &
                                    tag, &
                                    parametricCoord, &
@@ -2411,7 +2475,8 @@ module gmsh
   !> Evaluate the principal curvatures of the surface with tag `tag' at the
   !! parametric coordinates `parametricCoord', as well as their respective
   !! directions. `parametricCoord' are given by pair of u and v coordinates,
-  !! concatenated: [p1u, p1v, p2u, ...].
+  !! concatenated: [p1u, p1v, p2u, ...]. The points are evaluated using
+  !! `General.NumThreads' threads.
   subroutine gmshModelGetPrincipalCurvatures(tag, &
                                              parametricCoord, &
                                              curvatureMax, &
@@ -2489,6 +2554,7 @@ module gmsh
   !! `parametricCoord'. The `parametricCoord' vector should contain u and v
   !! coordinates, concatenated: [p1u, p1v, p2u, ...]. `normals' are returned as
   !! a vector of x, y, z components, concatenated: [n1x, n1y, n1z, n2x, ...].
+  !! The points are evaluated using `General.NumThreads' threads.
   subroutine gmshModelGetNormal(tag, &
                                 parametricCoord, &
                                 normals, &
@@ -2531,7 +2597,8 @@ module gmsh
   !! coordinates, concatenated: [p1x, p1y, p1z, p2x, ...]. `parametricCoord'
   !! returns the parametric coordinates t on the curve (if `dim' = 1) or u and v
   !! coordinates concatenated on the surface (if `dim' == 2), i.e. [p1t, p2t,
-  !! ...] or [p1u, p1v, p2u, ...].
+  !! ...] or [p1u, p1v, p2u, ...]. The points are evaluated using
+  !! `General.NumThreads' threads.
   subroutine gmshModelGetParametrization(dim, &
                                          tag, &
                                          coord, &
@@ -2669,7 +2736,8 @@ module gmsh
   !! `closestCoord' are given as x, y, z coordinates, concatenated: [p1x, p1y,
   !! p1z, p2x, ...]. `parametricCoord' returns the parametric coordinates t on
   !! the curve (if `dim' == 1) or u and v coordinates concatenated on the
-  !! surface (if `dim' = 2), i.e. [p1t, p2t, ...] or [p1u, p1v, p2u, ...].
+  !! surface (if `dim' = 2), i.e. [p1t, p2t, ...] or [p1u, p1v, p2u, ...]. The
+  !! points are evaluated using `General.NumThreads' threads.
   subroutine gmshModelGetClosestPoint(dim, &
                                       tag, &
                                       coord, &
@@ -2724,12 +2792,66 @@ module gmsh
       api_parametricCoord_n_)
   end subroutine gmshModelGetClosestPoint
 
+  !> Get the points on the entity of dimension `dim' and tag `tag' closest to
+  !! the points `coord' like `getClosestPoint', but write the coordinates and
+  !! the parametric coordinates of the closest points directly into the caller-
+  !! allocated buffers `closestCoord' and `parametricCoord', of length at least
+  !! 3 times and `dim' times the number of points, respectively. An empty buffer
+  !! is not filled. See `getValueInBuffers' for the buffer types in the
+  !! bindings. The points are evaluated using `General.NumThreads' threads.
+  subroutine gmshModelGetClosestPointInBuffers(dim, &
+                                               tag, &
+                                               coord, &
+                                               closestCoord, &
+                                               parametricCoord, &
+                                               ierr)
+    interface
+    subroutine C_API(dim, &
+                     tag, &
+                     api_coord_, &
+                     api_coord_n_, &
+                     api_closestCoord_, &
+                     api_closestCoord_n_, &
+                     api_parametricCoord_, &
+                     api_parametricCoord_n_, &
+                     ierr_) &
+      bind(C, name="gmshModelGetClosestPointInBuffers")
+      use, intrinsic :: iso_c_binding
+      integer(c_int), value, intent(in) :: dim
+      integer(c_int), value, intent(in) :: tag
+      real(c_double), dimension(*) :: api_coord_
+      integer(c_size_t), value, intent(in) :: api_coord_n_
+      real(c_double), dimension(*) :: api_closestCoord_
+      integer(c_size_t), value, intent(in) :: api_closestCoord_n_
+      real(c_double), dimension(*) :: api_parametricCoord_
+      integer(c_size_t), value, intent(in) :: api_parametricCoord_n_
+      integer(c_int), intent(out), optional :: ierr_
+    end subroutine C_API
+    end interface
+    integer, intent(in) :: dim
+    integer, intent(in) :: tag
+    real(c_double), dimension(:), intent(in) :: coord
+    real(c_double), dimension(:), intent(inout) :: closestCoord
+    real(c_double), dimension(:), intent(inout) :: parametricCoord
+    integer(c_int), intent(out), optional :: ierr
+    call C_API(dim=int(dim, c_int), &
+         tag=int(tag, c_int), &
+         api_coord_=coord, &
+         api_coord_n_=size_gmsh_double(coord), &
+         api_closestCoord_=closestCoord, &
+         api_closestCoord_n_=size_gmsh_double(closestCoord), &
+         api_parametricCoord_=parametricCoord, &
+         api_parametricCoord_n_=size_gmsh_double(parametricCoord), &
+         ierr_=ierr)
+  end subroutine gmshModelGetClosestPointInBuffers
+
   !> Reparametrize the boundary entity (point or curve, i.e. with `dim' == 0 or
   !! `dim' == 1) of tag `tag' on the surface `surfaceTag'. If `dim' == 1,
   !! reparametrize all the points corresponding to the parametric coordinates
   !! `parametricCoord'. Multiple matches in case of periodic surfaces can be
   !! selected with `which'. This feature is only available for a subset of
-  !! entities, depending on the underlying geometrical representation.
+  !! entities, depending on the underlying geometrical representation. The
+  !! points are evaluated using `General.NumThreads' threads.
   subroutine gmshModelReparametrizeOnSurface(dim, &
                                              tag, &
                                              parametricCoord, &
@@ -3524,6 +3646,87 @@ module gmsh
       api_parametricCoord_n_)
   end subroutine gmshModelMeshGetNodes
 
+  !> Get the number of nodes `numNodes' classified on the entity of dimension
+  !! `dim' and tag `tag'. If `tag' < 0, count the nodes for all entities of
+  !! dimension `dim'. If `dim' and `tag' are negative, count all the nodes in
+  !! the mesh. Can be used to allocate the buffers passed to
+  !! `getNodesInBuffers'.
+  subroutine gmshModelMeshGetNumberOfNodes(numNodes, &
+                                           dim, &
+                                           tag, &
+                                           ierr)
+    interface
+    subroutine C_API(numNodes, &
+                     dim, &
+                     tag, &
+                     ierr_) &
+      bind(C, name="gmshModelMeshGetNumberOfNodes")
+      use, intrinsic :: iso_c_binding
+      integer(c_size_t) :: numNodes
+      integer(c_int), value, intent(in) :: dim
+      integer(c_int), value, intent(in) :: tag
+      integer(c_int), intent(out), optional :: ierr_
+    end subroutine C_API
+    end interface
+    integer(c_size_t) :: numNodes
+    integer, intent(in), optional :: dim
+    integer, intent(in), optional :: tag
+    integer(c_int), intent(out), optional :: ierr
+    call C_API(numNodes=numNodes, &
+         dim=optval_c_int(-1, dim), &
+         tag=optval_c_int(-1, tag), &
+         ierr_=ierr)
+  end subroutine gmshModelMeshGetNumberOfNodes
+
+  !> Get the nodes classified on the entity of dimension `dim' and tag `tag'
+  !! like `getNodes' (without the boundary nodes and the parametric
+  !! coordinates), but write the node tags and coordinates directly into the
+  !! caller-allocated buffers `nodeTags' and `coord', of length at least
+  !! `numNodes' and 3 times `numNodes', respectively (with `numNodes' as
+  !! returned by `getNumberOfNodes'). An empty buffer is not filled. This avoids
+  !! any intermediate copy of the data between the library and the caller, in
+  !! particular in the Python, Julia and Fortran bindings (where the buffers
+  !! should be contiguous arrays of the right type, e.g. numpy arrays of type
+  !! `numpy.uintp' and `numpy.float64' in Python). The buffers are filled using
+  !! `General.NumThreads' threads.
+  subroutine gmshModelMeshGetNodesInBuffers(nodeTags, &
+                                            coord, &
+                                            dim, &
+                                            tag, &
+                                            ierr)
+    interface
+    subroutine C_API(api_nodeTags_, &
+                     api_nodeTags_n_, &
+                     api_coord_, &
+                     api_coord_n_, &
+                     dim, &
+                     tag, &
+                     ierr_) &
+      bind(C, name="gmshModelMeshGetNodesInBuffers")
+      use, intrinsic :: iso_c_binding
+      integer(c_size_t), dimension(*) :: api_nodeTags_
+      integer(c_size_t), value, intent(in) :: api_nodeTags_n_
+      real(c_double), dimension(*) :: api_coord_
+      integer(c_size_t), value, intent(in) :: api_coord_n_
+      integer(c_int), value, intent(in) :: dim
+      integer(c_int), value, intent(in) :: tag
+      integer(c_int), intent(out), optional :: ierr_
+    end subroutine C_API
+    end interface
+    integer(c_size_t), dimension(:), intent(inout) :: nodeTags
+    real(c_double), dimension(:), intent(inout) :: coord
+    integer, intent(in), optional :: dim
+    integer, intent(in), optional :: tag
+    integer(c_int), intent(out), optional :: ierr
+    call C_API(api_nodeTags_=nodeTags, &
+         api_nodeTags_n_=size_gmsh_size(nodeTags), &
+         api_coord_=coord, &
+         api_coord_n_=size_gmsh_double(coord), &
+         dim=optval_c_int(-1, dim), &
+         tag=optval_c_int(-1, tag), &
+         ierr_=ierr)
+  end subroutine gmshModelMeshGetNodesInBuffers
+
   !> Get the nodes classified on the entity of tag `tag', for all the elements
   !! of type `elementType'. The other arguments are treated as in `getNodes'.
   subroutine gmshModelMeshGetNodesByElementType(elementType, &
@@ -4345,7 +4548,8 @@ module gmsh
   !! this type of element, that contains the node tags of all the elements of
   !! the given type, concatenated: [e1n1, e1n2, ..., e1nN, e2n1, ...]. If
   !! `numTasks' > 1, only compute and return the part of the data indexed by
-  !! `task' (for C++ only; output vectors must be preallocated).
+  !! `task' (for C++ only; output vectors must be preallocated). Otherwise the
+  !! computation is multithreaded using `General.NumThreads' threads.
   subroutine gmshModelMeshGetElementsByType(elementType, &
                                             elementTags, &
                                             nodeTags, &
@@ -4402,6 +4606,83 @@ module gmsh
       api_nodeTags_n_)
   end subroutine gmshModelMeshGetElementsByType
 
+  !> Get the number of elements `numElements' of type `elementType' classified
+  !! on the entity of tag `tag'. If `tag' < 0, count the elements for all
+  !! entities. Can be used to allocate the buffers passed to
+  !! `getElementsByTypeInBuffers'.
+  subroutine gmshModelMeshGetNumberOfElementsByType(elementType, &
+                                                    numElements, &
+                                                    tag, &
+                                                    ierr)
+    interface
+    subroutine C_API(elementType, &
+                     numElements, &
+                     tag, &
+                     ierr_) &
+      bind(C, name="gmshModelMeshGetNumberOfElementsByType")
+      use, intrinsic :: iso_c_binding
+      integer(c_int), value, intent(in) :: elementType
+      integer(c_size_t) :: numElements
+      integer(c_int), value, intent(in) :: tag
+      integer(c_int), intent(out), optional :: ierr_
+    end subroutine C_API
+    end interface
+    integer, intent(in) :: elementType
+    integer(c_size_t) :: numElements
+    integer, intent(in), optional :: tag
+    integer(c_int), intent(out), optional :: ierr
+    call C_API(elementType=int(elementType, c_int), &
+         numElements=numElements, &
+         tag=optval_c_int(-1, tag), &
+         ierr_=ierr)
+  end subroutine gmshModelMeshGetNumberOfElementsByType
+
+  !> Get the elements of type `elementType' classified on the entity of tag
+  !! `tag' like `getElementsByType', but write the element tags and the node
+  !! tags directly into the caller-allocated buffers `elementTags' and
+  !! `nodeTags', of length at least `numElements' and `numElements' times the
+  !! number of nodes per element, respectively (with `numElements' as returned
+  !! by `getNumberOfElementsByType'). An empty buffer is not filled. See
+  !! `getNodesInBuffers' for the buffer types in the bindings. The buffers are
+  !! filled using `General.NumThreads' threads.
+  subroutine gmshModelMeshGetElementsByTypeInBuffers(elementType, &
+                                                     elementTags, &
+                                                     nodeTags, &
+                                                     tag, &
+                                                     ierr)
+    interface
+    subroutine C_API(elementType, &
+                     api_elementTags_, &
+                     api_elementTags_n_, &
+                     api_nodeTags_, &
+                     api_nodeTags_n_, &
+                     tag, &
+                     ierr_) &
+      bind(C, name="gmshModelMeshGetElementsByTypeInBuffers")
+      use, intrinsic :: iso_c_binding
+      integer(c_int), value, intent(in) :: elementType
+      integer(c_size_t), dimension(*) :: api_elementTags_
+      integer(c_size_t), value, intent(in) :: api_elementTags_n_
+      integer(c_size_t), dimension(*) :: api_nodeTags_
+      integer(c_size_t), value, intent(in) :: api_nodeTags_n_
+      integer(c_int), value, intent(in) :: tag
+      integer(c_int), intent(out), optional :: ierr_
+    end subroutine C_API
+    end interface
+    integer, intent(in) :: elementType
+    integer(c_size_t), dimension(:), intent(inout) :: elementTags
+    integer(c_size_t), dimension(:), intent(inout) :: nodeTags
+    integer, intent(in), optional :: tag
+    integer(c_int), intent(out), optional :: ierr
+    call C_API(elementType=int(elementType, c_int), &
+         api_elementTags_=elementTags, &
+         api_elementTags_n_=size_gmsh_size(elementTags), &
+         api_nodeTags_=nodeTags, &
+         api_nodeTags_n_=size_gmsh_size(nodeTags), &
+         tag=optval_c_int(-1, tag), &
+         ierr_=ierr)
+  end subroutine gmshModelMeshGetElementsByTypeInBuffers
+
   !> Get the maximum tag `maxTag' of an element in the mesh.
   subroutine gmshModelMeshGetMaxElementTag(maxTag, &
                                            ierr)
@@ -4538,6 +4819,63 @@ module gmsh
       api_elementsQuality_n_)
   end subroutine gmshModelMeshGetElementQualities
 
+  !> Get the quality `elementQualities' of all the elements of type
+  !! `elementType' classified on the entity of tag `tag', as well as their tags
+  !! `elementTags'. If `tag' < 0, get the elements for all entities.
+  !! `qualityName' is the requested quality measure (see `getElementQualities').
+  !! The measures are computed in parallel if possible, and are cached on the
+  !! entities until the mesh changes.
+  subroutine gmshModelMeshGetElementQualitiesByType(elementType, &
+                                                    elementTags, &
+                                                    elementQualities, &
+                                                    qualityName, &
+                                                    tag, &
+                                                    ierr)
+    interface
+    subroutine C_API(elementType, &
+                     api_elementTags_, &
+                     api_elementTags_n_, &
+                     api_elementQualities_, &
+                     api_elementQualities_n_, &
+                     qualityName, &
+                     tag, &
+                     ierr_) &
+      bind(C, name="gmshModelMeshGetElementQualitiesByType")
+      use, intrinsic :: iso_c_binding
+      integer(c_int), value, intent(in) :: elementType
+      type(c_ptr), intent(out) :: api_elementTags_
+      integer(c_size_t), intent(out) :: api_elementTags_n_
+      type(c_ptr), intent(out) :: api_elementQualities_
+      integer(c_size_t) :: api_elementQualities_n_
+      character(len=1, kind=c_char), dimension(*), intent(in), optional :: qualityName
+      integer(c_int), value, intent(in) :: tag
+      integer(c_int), intent(out), optional :: ierr_
+    end subroutine C_API
+    end interface
+    integer, intent(in) :: elementType
+    integer(c_size_t), dimension(:), allocatable, intent(out) :: elementTags
+    real(c_double), dimension(:), allocatable, intent(out) :: elementQualities
+    character(len=*), intent(in), optional :: qualityName
+    integer, intent(in), optional :: tag
+    integer(c_int), intent(out), optional :: ierr
+    type(c_ptr) :: api_elementTags_
+    integer(c_size_t) :: api_elementTags_n_
+    type(c_ptr) :: api_elementQualities_
+    integer(c_size_t) :: api_elementQualities_n_
+    call C_API(elementType=int(elementType, c_int), &
+         api_elementTags_=api_elementTags_, &
+         api_elementTags_n_=api_elementTags_n_, &
+         api_elementQualities_=api_elementQualities_, &
+         api_elementQualities_n_=api_elementQualities_n_, &
+         qualityName=istring_(optval_c_str("minSICN", qualityName)), &
+         tag=optval_c_int(-1, tag), &
+         ierr_=ierr)
+    elementTags = ovectorsize_(api_elementTags_, &
+      api_elementTags_n_)
+    elementQualities = ovectordouble_(api_elementQualities_, &
+      api_elementQualities_n_)
+  end subroutine gmshModelMeshGetElementQualitiesByType
+
   !> Add elements classified on the entity of dimension `dim' and tag `tag'.
   !! `types' contains the MSH types of the elements (e.g. `2' for 3-node
   !! triangles: see the Gmsh reference manual). `elementTags' is a vector of the
@@ -4737,7 +5075,8 @@ module gmsh
   !! coordinates of the evaluation points. If `tag' < 0, get the Jacobian data
   !! for all entities. If `numTasks' > 1, only compute and return the part of
   !! the data indexed by `task' (for C++ only; output vectors must be
-  !! preallocated).
+  !! preallocated). Otherwise the computation is multithreaded using
+  !! `General.NumThreads' threads.
   subroutine gmshModelMeshGetJacobians(elementType, &
                                        localCoord, &
                                        jacobians, &
@@ -5053,7 +5392,8 @@ module gmsh
   !! `getBasisFunctions'. For Lagrange basis functions the call is superfluous
   !! as it will return a vector of zeros. If `numTasks' > 1, only compute and
   !! return the part of the data indexed by `task' (for C++ only; output vector
-  !! must be preallocated).
+  !! must be preallocated). Otherwise the computation is multithreaded using
+  !! `General.NumThreads' threads.
   subroutine gmshModelMeshGetBasisFunctionsOrientation(elementType, &
                                                        functionSpaceType, &
                                                        basisFunctionsOrientation, &
@@ -5719,7 +6059,8 @@ module gmsh
   !! (without normalizing by the number of nodes). If `tag' < 0, get the
   !! barycenters for all entities. If `numTasks' > 1, only compute and return
   !! the part of the data indexed by `task' (for C++ only; output vector must be
-  !! preallocated).
+  !! preallocated). Otherwise the computation is multithreaded using
+  !! `General.NumThreads' threads.
   subroutine gmshModelMeshGetBarycenters(elementType, &
                                          tag, &
                                          fast, &
@@ -5818,6 +6159,8 @@ module gmsh
   !! nodes of the edges are returned. If `tag' < 0, get the edge nodes for all
   !! entities. If `numTasks' > 1, only compute and return the part of the data
   !! indexed by `task' (for C++ only; output vector must be preallocated).
+  !! Otherwise the computation is multithreaded using `General.NumThreads'
+  !! threads.
   subroutine gmshModelMeshGetElementEdgeNodes(elementType, &
                                               nodeTags, &
                                               tag, &
@@ -5876,6 +6219,8 @@ module gmsh
   !! of the faces are returned. If `tag' < 0, get the face nodes for all
   !! entities. If `numTasks' > 1, only compute and return the part of the data
   !! indexed by `task' (for C++ only; output vector must be preallocated).
+  !! Otherwise the computation is multithreaded using `General.NumThreads'
+  !! threads.
   subroutine gmshModelMeshGetElementFaceNodes(elementType, &
                                               faceType, &
                                               nodeTags, &
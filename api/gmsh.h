@@ -451,12 +451,27 @@ namespace gmsh { // Top-level functions
     // parametric coordinates on the curve) or 2 (with `parametricCoord' containing
     // u, v parametric coordinates on the surface, concatenated: [p1u, p1v, p2u,
     // ...]). Return x, y, z coordinates in `coord', concatenated: [p1x, p1y, p1z,
-    // p2x, ...].
+    // p2x, ...]. The points are evaluated using `General.NumThreads' threads.
     GMSH_API void getValue(const int dim,
                            const int tag,
                            const std::vector<double> & parametricCoord,
                            std::vector<double> & coord);
 
+    // gmsh::model::getValueInBuffers
+    //
+    // Evaluate the parametrization of the entity of dimension `dim' and tag `tag'
+    // at the parametric coordinates `parametricCoord' like `getValue', but write
+    // the x, y, z coordinates directly into the caller-allocated buffer `coord',
+    // of length at least 3 times the number of points. This avoids any
+    // intermediate copy of the result, e.g. when evaluating many points in a loop
+    // from the Python, Julia or Fortran bindings (where the buffer should be a
+    // contiguous array of doubles, e.g. a numpy array of type `numpy.float64' in
+    // Python). The points are evaluated using `General.NumThreads' threads.
+    GMSH_API void getValueInBuffers(const int dim,
+                                    const int tag,
+                                    const std::vector<double> & parametricCoord,
+                                    double * coord, const std::size_t coord_n);
+
     // gmsh::model::getDerivative
     //
     // Evaluate the derivative of the parametrization of the entity of dimension
@@ -467,7 +482,8 @@ namespace gmsh { // Top-level functions
     // For `dim' equal to 1 return the x, y, z components of the derivative with
     // respect to u [d1ux, d1uy, d1uz, d2ux, ...]; for `dim' equal to 2 return the
     // x, y, z components of the derivative with respect to u and v: [d1ux, d1uy,
-    // d1uz, d1vx, d1vy, d1vz, d2ux, ...].
+    // d1uz, d1vx, d1vy, d1vz, d2ux, ...]. The points are evaluated using
+    // `General.NumThreads' threads.
     GMSH_API void getDerivative(const int dim,
                                 const int tag,
                                 const std::vector<double> & parametricCoord,
@@ -485,6 +501,7 @@ namespace gmsh { // Top-level functions
     // `dim' equal to 2 return the x, y, z components of the second derivative with
     // respect to u and v, and the mixed derivative with respect to u and v:
     // [d1uux, d1uuy, d1uuz, d1vvx, d1vvy, d1vvz, d1uvx, d1uvy, d1uvz, d2uux, ...].
+    // The points are evaluated using `General.NumThreads' threads.
     GMSH_API void getSecondDerivative(const int dim,
                                       const int tag,
                                       const std::vector<double> & parametricCoord,
@@ -496,7 +513,8 @@ namespace gmsh { // Top-level functions
     // `tag' at the parametric coordinates `parametricCoord'. Only valid for `dim'
     // equal to 1 (with `parametricCoord' containing parametric coordinates on the
     // curve) or 2 (with `parametricCoord' containing u, v parametric coordinates
-    // on the surface, concatenated: [p1u, p1v, p2u, ...]).
+    // on the surface, concatenated: [p1u, p1v, p2u, ...]). The points are
+    // evaluated using `General.NumThreads' threads.
     GMSH_API void getCurvature(const int dim,
                                const int tag,
                                const std::vector<double> & parametricCoord,
@@ -507,7 +525,8 @@ namespace gmsh { // Top-level functions
     // Evaluate the principal curvatures of the surface with tag `tag' at the
     // parametric coordinates `parametricCoord', as well as their respective
     // directions. `parametricCoord' are given by pair of u and v coordinates,
-    // concatenated: [p1u, p1v, p2u, ...].
+    // concatenated: [p1u, p1v, p2u, ...]. The points are evaluated using
+    // `General.NumThreads' threads.
     GMSH_API void getPrincipalCurvatures(const int tag,
                                          const std::vector<double> & parametricCoord,
                                          std::vector<double> & curvatureMax,
@@ -520,7 +539,8 @@ namespace gmsh { // Top-level functions
     // Get the normal to the surface with tag `tag' at the parametric coordinates
     // `parametricCoord'. The `parametricCoord' vector should contain u and v
     // coordinates, concatenated: [p1u, p1v, p2u, ...]. `normals' are returned as a
-    // vector of x, y, z components, concatenated: [n1x, n1y, n1z, n2x, ...].
+    // vector of x, y, z components, concatenated: [n1x, n1y, n1z, n2x, ...]. The
+    // points are evaluated using `General.NumThreads' threads.
     GMSH_API void getNormal(const int tag,
                             const std::vector<double> & parametricCoord,
                             std::vector<double> & normals);
@@ -532,7 +552,8 @@ namespace gmsh { // Top-level functions
     // coordinates, concatenated: [p1x, p1y, p1z, p2x, ...]. `parametricCoord'
     // returns the parametric coordinates t on the curve (if `dim' = 1) or u and v
     // coordinates concatenated on the surface (if `dim' == 2), i.e. [p1t, p2t,
-    // ...] or [p1u, p1v, p2u, ...].
+    // ...] or [p1u, p1v, p2u, ...]. The points are evaluated using
+    // `General.NumThreads' threads.
     GMSH_API void getParametrization(const int dim,
                                      const int tag,
                                      const std::vector<double> & coord,
@@ -566,13 +587,29 @@ namespace gmsh { // Top-level functions
     // are given as x, y, z coordinates, concatenated: [p1x, p1y, p1z, p2x, ...].
     // `parametricCoord' returns the parametric coordinates t on the curve (if
     // `dim' == 1) or u and v coordinates concatenated on the surface (if `dim' =
-    // 2), i.e. [p1t, p2t, ...] or [p1u, p1v, p2u, ...].
+    // 2), i.e. [p1t, p2t, ...] or [p1u, p1v, p2u, ...]. The points are evaluated
+    // using `General.NumThreads' threads.
     GMSH_API void getClosestPoint(const int dim,
                                   const int tag,
                                   const std::vector<double> & coord,
                                   std::vector<double> & closestCoord,
                                   std::vector<double> & parametricCoord);
 
+    // gmsh::model::getClosestPointInBuffers
+    //
+    // Get the points on the entity of dimension `dim' and tag `tag' closest to the
+    // points `coord' like `getClosestPoint', but write the coordinates and the
+    // parametric coordinates of the closest points directly into the caller-
+    // allocated buffers `closestCoord' and `parametricCoord', of length at least 3
+    // times and `dim' times the number of points, respectively. An empty buffer is
+    // not filled. See `getValueInBuffers' for the buffer types in the bindings.
+    // The points are evaluated using `General.NumThreads' threads.
+    GMSH_API void getClosestPointInBuffers(const int dim,
+                                           const int tag,
+                                           const std::vector<double> & coord,
+                                           double * closestCoord, const std::size_t closestCoord_n,
+                                           double * parametricCoord, const std::size_t parametricCoord_n);
+
     // gmsh::model::reparametrizeOnSurface
     //
     // Reparametrize the boundary entity (point or curve, i.e. with `dim' == 0 or
@@ -580,7 +617,8 @@ namespace gmsh { // Top-level functions
     // reparametrize all the points corresponding to the parametric coordinates
     // `parametricCoord'. Multiple matches in case of periodic surfaces can be
     // selected with `which'. This feature is only available for a subset of
-    // entities, depending on the underlying geometrical representation.
+    // entities, depending on the underlying geometrical representation. The points
+    // are evaluated using `General.NumThreads' threads.
     GMSH_API void reparametrizeOnSurface(const int dim,
                                          const int tag,
                                          const std::vector<double> & parametricCoord,
@@ -798,6 +836,35 @@ namespace gmsh { // Top-level functions
                              const bool includeBoundary = false,
                              const bool returnParametricCoord = true);
 
+      // gmsh::model::mesh::getNumberOfNodes
+      //
+      // Get the number of nodes `numNodes' classified on the entity of dimension
+      // `dim' and tag `tag'. If `tag' < 0, count the nodes for all entities of
+      // dimension `dim'. If `dim' and `tag' are negative, count all the nodes in
+      // the mesh. Can be used to allocate the buffers passed to
+      // `getNodesInBuffers'.
+      GMSH_API void getNumberOfNodes(std::size_t & numNodes,
+                                     const int dim = -1,
+                                     const int tag = -1);
+
+      // gmsh::model::mesh::getNodesInBuffers
+      //
+      // Get the nodes classified on the entity of dimension `dim' and tag `tag'
+      // like `getNodes' (without the boundary nodes and the parametric
+      // coordinates), but write the node tags and coordinates directly into the
+      // caller-allocated buffers `nodeTags' and `coord', of length at least
+      // `numNodes' and 3 times `numNodes', respectively (with `numNodes' as
+      // returned by `getNumberOfNodes'). An empty buffer is not filled. This
+      // avoids any intermediate copy of the data between the library and the
+      // caller, in particular in the Python, Julia and Fortran bindings (where the
+      // buffers should be contiguous arrays of the right type, e.g. numpy arrays
+      // of type `numpy.uintp' and `numpy.float64' in Python). The buffers are
+      // filled using `General.NumThreads' threads.
+      GMSH_API void getNodesInBuffers(std::size_t * nodeTags, const std::size_t nodeTags_n,
+                                      double * coord, const std::size_t coord_n,
+                                      const int dim = -1,
+                                      const int tag = -1);
+
       // gmsh::model::mesh::getNodesByElementType
       //
       // Get the nodes classified on the entity of tag `tag', for all the elements
@@ -1022,7 +1089,8 @@ namespace gmsh { // Top-level functions
       // for this type of element, that contains the node tags of all the elements
       // of the given type, concatenated: [e1n1, e1n2, ..., e1nN, e2n1, ...]. If
       // `numTasks' > 1, only compute and return the part of the data indexed by
-      // `task' (for C++ only; output vectors must be preallocated).
+      // `task' (for C++ only; output vectors must be preallocated). Otherwise the
+      // computation is multithreaded using `General.NumThreads' threads.
       GMSH_API void getElementsByType(const int elementType,
                                       std::vector<std::size_t> & elementTags,
                                       std::vector<std::size_t> & nodeTags,
@@ -1030,6 +1098,31 @@ namespace gmsh { // Top-level functions
                                       const std::size_t task = 0,
                                       const std::size_t numTasks = 1);
 
+      // gmsh::model::mesh::getNumberOfElementsByType
+      //
+      // Get the number of elements `numElements' of type `elementType' classified
+      // on the entity of tag `tag'. If `tag' < 0, count the elements for all
+      // entities. Can be used to allocate the buffers passed to
+      // `getElementsByTypeInBuffers'.
+      GMSH_API void getNumberOfElementsByType(const int elementType,
+                                              std::size_t & numElements,
+                                              const int tag = -1);
+
+      // gmsh::model::mesh::getElementsByTypeInBuffers
+      //
+      // Get the elements of type `elementType' classified on the entity of tag
+      // `tag' like `getElementsByType', but write the element tags and the node
+      // tags directly into the caller-allocated buffers `elementTags' and
+      // `nodeTags', of length at least `numElements' and `numElements' times the
+      // number of nodes per element, respectively (with `numElements' as returned
+      // by `getNumberOfElementsByType'). An empty buffer is not filled. See
+      // `getNodesInBuffers' for the buffer types in the bindings. The buffers are
+      // filled using `General.NumThreads' threads.
+      GMSH_API void getElementsByTypeInBuffers(const int elementType,
+                                               std::size_t * elementTags, const std::size_t elementTags_n,
+                                               std::size_t * nodeTags, const std::size_t nodeTags_n,
+                                               const int tag = -1);
+
       // gmsh::model::mesh::getMaxElementTag
       //
       // Get the maximum tag `maxTag' of an element in the mesh.
@@ -1067,6 +1160,20 @@ namespace gmsh { // Top-level functions
                                         const std::size_t task = 0,
                                         const std::size_t numTasks = 1);
 
+      // gmsh::model::mesh::getElementQualitiesByType
+      //
+      // Get the quality `elementQualities' of all the elements of type
+      // `elementType' classified on the entity of tag `tag', as well as their tags
+      // `elementTags'. If `tag' < 0, get the elements for all entities.
+      // `qualityName' is the requested quality measure (see
+      // `getElementQualities'). The measures are computed in parallel if possible,
+      // and are cached on the entities until the mesh changes.
+      GMSH_API void getElementQualitiesByType(const int elementType,
+                                              std::vector<std::size_t> & elementTags,
+                                              std::vector<double> & elementQualities,
+                                              const std::string & qualityName = "minSICN",
+                                              const int tag = -1);
+
       // gmsh::model::mesh::addElements
       //
       // Add elements classified on the entity of dimension `dim' and tag `tag'.
@@ -1134,7 +1241,8 @@ namespace gmsh { // Top-level functions
       // coordinates of the evaluation points. If `tag' < 0, get the Jacobian data
       // for all entities. If `numTasks' > 1, only compute and return the part of
       // the data indexed by `task' (for C++ only; output vectors must be
-      // preallocated).
+      // preallocated). Otherwise the computation is multithreaded using
+      // `General.NumThreads' threads.
       GMSH_API void getJacobians(const int elementType,
                                  const std::vector<double> & localCoord,
                                  std::vector<double> & jacobians,
@@ -1216,7 +1324,8 @@ namespace gmsh { // Top-level functions
       // `getBasisFunctions'. For Lagrange basis functions the call is superfluous
       // as it will return a vector of zeros. If `numTasks' > 1, only compute and
       // return the part of the data indexed by `task' (for C++ only; output vector
-      // must be preallocated).
+      // must be preallocated). Otherwise the computation is multithreaded using
+      // `General.NumThreads' threads.
       GMSH_API void getBasisFunctionsOrientation(const int elementType,
                                                  const std::string & functionSpaceType,
                                                  std::vector<int> & basisFunctionsOrientation,
@@ -1373,7 +1482,8 @@ namespace gmsh { // Top-level functions
       // coordinates (without normalizing by the number of nodes). If `tag' < 0,
       // get the barycenters for all entities. If `numTasks' > 1, only compute and
       // return the part of the data indexed by `task' (for C++ only; output vector
-      // must be preallocated).
+      // must be preallocated). Otherwise the computation is multithreaded using
+      // `General.NumThreads' threads.
       GMSH_API void getBarycenters(const int elementType,
                                    const int tag,
                                    const bool fast,
@@ -1400,6 +1510,8 @@ namespace gmsh { // Top-level functions
       // nodes of the edges are returned. If `tag' < 0, get the edge nodes for all
       // entities. If `numTasks' > 1, only compute and return the part of the data
       // indexed by `task' (for C++ only; output vector must be preallocated).
+      // Otherwise the computation is multithreaded using `General.NumThreads'
+      // threads.
       GMSH_API void getElementEdgeNodes(const int elementType,
                                         std::vector<std::size_t> & nodeTags,
                                         const int tag = -1,
@@ -1418,6 +1530,8 @@ namespace gmsh { // Top-level functions
       // nodes of the faces are returned. If `tag' < 0, get the face nodes for all
       // entities. If `numTasks' > 1, only compute and return the part of the data
       // indexed by `task' (for C++ only; output vector must be preallocated).
+      // Otherwise the computation is multithreaded using `General.NumThreads'
+      // threads.
       GMSH_API void getElementFaceNodes(const int elementType,
                                         const int faceType,
                                         std::vector<std::size_t> & nodeTags,
@@ -1118,6 +1118,7 @@ the parametric coordinates `parametricCoord`. Only valid for `dim` equal to 0
 coordinates on the curve) or 2 (with `parametricCoord` containing u, v
 parametric coordinates on the surface, concatenated: [p1u, p1v, p2u, ...]).
 Return x, y, z coordinates in `coord`, concatenated: [p1x, p1y, p1z, p2x, ...].
+The points are evaluated using `General.NumThreads` threads.
 
 Return `coord`.
 
@@ -1140,6 +1141,34 @@ function getValue(dim, tag, parametricCoord)
 end
 const get_value = getValue
 
+"""
+    gmsh.model.getValueInBuffers(dim, tag, parametricCoord, coord)
+
+Evaluate the parametrization of the entity of dimension `dim` and tag `tag` at
+the parametric coordinates `parametricCoord` like `getValue`, but write the x,
+y, z coordinates directly into the caller-allocated buffer `coord`, of length at
+least 3 times the number of points. This avoids any intermediate copy of the
+result, e.g. when evaluating many points in a loop from the Python, Julia or
+Fortran bindings (where the buffer should be a contiguous array of doubles, e.g.
+a numpy array of type `numpy.float64` in Python). The points are evaluated using
+`General.NumThreads` threads.
+
+Types:
+ - `dim`: integer
+ - `tag`: integer
+ - `parametricCoord`: vector of doubles
+ - `coord`: buffer of doubles
+"""
+function getValueInBuffers(dim, tag, parametricCoord, coord)
+    ierr = Ref{Cint}()
+    ccall((:gmshModelGetValueInBuffers, gmsh.lib), Cvoid,
+          (Cint, Cint, Ptr{Cdouble}, Csize_t, Ptr{Cdouble}, Csize_t, Ptr{Cint}),
+          dim, tag, convert(Vector{Cdouble}, parametricCoord), length(parametricCoord), coord, length(coord), ierr)
+    ierr[] != 0 && error(gmsh.logger.getLastError())
+    return nothing
+end
+const get_value_in_buffers = getValueInBuffers
+
 """
     gmsh.model.getDerivative(dim, tag, parametricCoord)
 
@@ -1150,7 +1179,8 @@ the curve) or 2 (with `parametricCoord` containing u, v parametric coordinates
 on the surface, concatenated: [p1u, p1v, p2u, ...]). For `dim` equal to 1 return
 the x, y, z components of the derivative with respect to u [d1ux, d1uy, d1uz,
 d2ux, ...]; for `dim` equal to 2 return the x, y, z components of the derivative
-with respect to u and v: [d1ux, d1uy, d1uz, d1vx, d1vy, d1vz, d2ux, ...].
+with respect to u and v: [d1ux, d1uy, d1uz, d1vx, d1vy, d1vz, d2ux, ...]. The
+points are evaluated using `General.NumThreads` threads.
 
 Return `derivatives`.
 
@@ -1185,7 +1215,8 @@ to 1 return the x, y, z components of the second derivative with respect to u
 [d1uux, d1uuy, d1uuz, d2uux, ...]; for `dim` equal to 2 return the x, y, z
 components of the second derivative with respect to u and v, and the mixed
 derivative with respect to u and v: [d1uux, d1uuy, d1uuz, d1vvx, d1vvy, d1vvz,
-d1uvx, d1uvy, d1uvz, d2uux, ...].
+d1uvx, d1uvy, d1uvz, d2uux, ...]. The points are evaluated using
+`General.NumThreads` threads.
 
 Return `derivatives`.
 
@@ -1215,7 +1246,8 @@ Evaluate the (maximum) curvature of the entity of dimension `dim` and tag `tag`
 at the parametric coordinates `parametricCoord`. Only valid for `dim` equal to 1
 (with `parametricCoord` containing parametric coordinates on the curve) or 2
 (with `parametricCoord` containing u, v parametric coordinates on the surface,
-concatenated: [p1u, p1v, p2u, ...]).
+concatenated: [p1u, p1v, p2u, ...]). The points are evaluated using
+`General.NumThreads` threads.
 
 Return `curvatures`.
 
@@ -1244,7 +1276,8 @@ const get_curvature = getCurvature
 Evaluate the principal curvatures of the surface with tag `tag` at the
 parametric coordinates `parametricCoord`, as well as their respective
 directions. `parametricCoord` are given by pair of u and v coordinates,
-concatenated: [p1u, p1v, p2u, ...].
+concatenated: [p1u, p1v, p2u, ...]. The points are evaluated using
+`General.NumThreads` threads.
 
 Return `curvatureMax`, `curvatureMin`, `directionMax`, `directionMin`.
 
@@ -1284,7 +1317,8 @@ const get_principal_curvatures = getPrincipalCurvatures
 Get the normal to the surface with tag `tag` at the parametric coordinates
 `parametricCoord`. The `parametricCoord` vector should contain u and v
 coordinates, concatenated: [p1u, p1v, p2u, ...]. `normals` are returned as a
-vector of x, y, z components, concatenated: [n1x, n1y, n1z, n2x, ...].
+vector of x, y, z components, concatenated: [n1x, n1y, n1z, n2x, ...]. The
+points are evaluated using `General.NumThreads` threads.
 
 Return `normals`.
 
@@ -1314,7 +1348,7 @@ entity of dimension `dim` and tag `tag`. `coord` are given as x, y, z
 coordinates, concatenated: [p1x, p1y, p1z, p2x, ...]. `parametricCoord` returns
 the parametric coordinates t on the curve (if `dim` = 1) or u and v coordinates
 concatenated on the surface (if `dim` == 2), i.e. [p1t, p2t, ...] or [p1u, p1v,
-p2u, ...].
+p2u, ...]. The points are evaluated using `General.NumThreads` threads.
 
 Return `parametricCoord`.
 
@@ -1402,7 +1436,8 @@ the points `coord`, by orthogonal projection. `coord` and `closestCoord` are
 given as x, y, z coordinates, concatenated: [p1x, p1y, p1z, p2x, ...].
 `parametricCoord` returns the parametric coordinates t on the curve (if `dim` ==
 1) or u and v coordinates concatenated on the surface (if `dim` = 2), i.e. [p1t,
-p2t, ...] or [p1u, p1v, p2u, ...].
+p2t, ...] or [p1u, p1v, p2u, ...]. The points are evaluated using
+`General.NumThreads` threads.
 
 Return `closestCoord`, `parametricCoord`.
 
@@ -1429,6 +1464,34 @@ function getClosestPoint(dim, tag, coord)
 end
 const get_closest_point = getClosestPoint
 
+"""
+    gmsh.model.getClosestPointInBuffers(dim, tag, coord, closestCoord, parametricCoord)
+
+Get the points on the entity of dimension `dim` and tag `tag` closest to the
+points `coord` like `getClosestPoint`, but write the coordinates and the
+parametric coordinates of the closest points directly into the caller-allocated
+buffers `closestCoord` and `parametricCoord`, of length at least 3 times and
+`dim` times the number of points, respectively. An empty buffer is not filled.
+See `getValueInBuffers` for the buffer types in the bindings. The points are
+evaluated using `General.NumThreads` threads.
+
+Types:
+ - `dim`: integer
+ - `tag`: integer
+ - `coord`: vector of doubles
+ - `closestCoord`: buffer of doubles
+ - `parametricCoord`: buffer of doubles
+"""
+function getClosestPointInBuffers(dim, tag, coord, closestCoord, parametricCoord)
+    ierr = Ref{Cint}()
+    ccall((:gmshModelGetClosestPointInBuffers, gmsh.lib), Cvoid,
+          (Cint, Cint, Ptr{Cdouble}, Csize_t, Ptr{Cdouble}, Csize_t, Ptr{Cdouble}, Csize_t, Ptr{Cint}),
+          dim, tag, convert(Vector{Cdouble}, coord), length(coord), closestCoord, length(closestCoord), parametricCoord, length(parametricCoord), ierr)
+    ierr[] != 0 && error(gmsh.logger.getLastError())
+    return nothing
+end
+const get_closest_point_in_buffers = getClosestPointInBuffers
+
 """
     gmsh.model.reparametrizeOnSurface(dim, tag, parametricCoord, surfaceTag, which = 0)
 
@@ -1437,7 +1500,8 @@ Reparametrize the boundary entity (point or curve, i.e. with `dim` == 0 or `dim`
 the points corresponding to the parametric coordinates `parametricCoord`.
 Multiple matches in case of periodic surfaces can be selected with `which`. This
 feature is only available for a subset of entities, depending on the underlying
-geometrical representation.
+geometrical representation. The points are evaluated using `General.NumThreads`
+threads.
 
 Return `surfaceParametricCoord`.
 
@@ -2035,6 +2099,62 @@ function getNodes(dim = -1, tag = -1, includeBoundary = false, returnParametricC
 end
 const get_nodes = getNodes
 
+"""
+    gmsh.model.mesh.getNumberOfNodes(dim = -1, tag = -1)
+
+Get the number of nodes `numNodes` classified on the entity of dimension `dim`
+and tag `tag`. If `tag` < 0, count the nodes for all entities of dimension
+`dim`. If `dim` and `tag` are negative, count all the nodes in the mesh. Can be
+used to allocate the buffers passed to `getNodesInBuffers`.
+
+Return `numNodes`.
+
+Types:
+ - `numNodes`: size
+ - `dim`: integer
+ - `tag`: integer
+"""
+function getNumberOfNodes(dim = -1, tag = -1)
+    api_numNodes_ = Ref{Csize_t}()
+    ierr = Ref{Cint}()
+    ccall((:gmshModelMeshGetNumberOfNodes, gmsh.lib), Cvoid,
+          (Ptr{Csize_t}, Cint, Cint, Ptr{Cint}),
+          api_numNodes_, dim, tag, ierr)
+    ierr[] != 0 && error(gmsh.logger.getLastError())
+    return api_numNodes_[]
+end
+const get_number_of_nodes = getNumberOfNodes
+
+"""
+    gmsh.model.mesh.getNodesInBuffers(nodeTags, coord, dim = -1, tag = -1)
+
+Get the nodes classified on the entity of dimension `dim` and tag `tag` like
+`getNodes` (without the boundary nodes and the parametric coordinates), but
+write the node tags and coordinates directly into the caller-allocated buffers
+`nodeTags` and `coord`, of length at least `numNodes` and 3 times `numNodes`,
+respectively (with `numNodes` as returned by `getNumberOfNodes`). An empty
+buffer is not filled. This avoids any intermediate copy of the data between the
+library and the caller, in particular in the Python, Julia and Fortran bindings
+(where the buffers should be contiguous arrays of the right type, e.g. numpy
+arrays of type `numpy.uintp` and `numpy.float64` in Python). The buffers are
+filled using `General.NumThreads` threads.
+
+Types:
+ - `nodeTags`: buffer of sizes
+ - `coord`: buffer of doubles
+ - `dim`: integer
+ - `tag`: integer
+"""
+function getNodesInBuffers(nodeTags, coord, dim = -1, tag = -1)
+    ierr = Ref{Cint}()
+    ccall((:gmshModelMeshGetNodesInBuffers, gmsh.lib), Cvoid,
+          (Ptr{Csize_t}, Csize_t, Ptr{Cdouble}, Csize_t, Cint, Cint, Ptr{Cint}),
+          nodeTags, length(nodeTags), coord, length(coord), dim, tag, ierr)
+    ierr[] != 0 && error(gmsh.logger.getLastError())
+    return nothing
+end
+const get_nodes_in_buffers = getNodesInBuffers
+
 """
     gmsh.model.mesh.getNodesByElementType(elementType, tag = -1, returnParametricCoord = true)
 
@@ -2581,7 +2701,8 @@ elements of the given type times the number N of nodes for this type of element,
 that contains the node tags of all the elements of the given type, concatenated:
 [e1n1, e1n2, ..., e1nN, e2n1, ...]. If `numTasks` > 1, only compute and return
 the part of the data indexed by `task` (for C++ only; output vectors must be
-preallocated).
+preallocated). Otherwise the computation is multithreaded using
+`General.NumThreads` threads.
 
 Return `elementTags`, `nodeTags`.
 
@@ -2609,6 +2730,58 @@ function getElementsByType(elementType, tag = -1, task = 0, numTasks = 1)
 end
 const get_elements_by_type = getElementsByType
 
+"""
+    gmsh.model.mesh.getNumberOfElementsByType(elementType, tag = -1)
+
+Get the number of elements `numElements` of type `elementType` classified on the
+entity of tag `tag`. If `tag` < 0, count the elements for all entities. Can be
+used to allocate the buffers passed to `getElementsByTypeInBuffers`.
+
+Return `numElements`.
+
+Types:
+ - `elementType`: integer
+ - `numElements`: size
+ - `tag`: integer
+"""
+function getNumberOfElementsByType(elementType, tag = -1)
+    api_numElements_ = Ref{Csize_t}()
+    ierr = Ref{Cint}()
+    ccall((:gmshModelMeshGetNumberOfElementsByType, gmsh.lib), Cvoid,
+          (Cint, Ptr{Csize_t}, Cint, Ptr{Cint}),
+          elementType, api_numElements_, tag, ierr)
+    ierr[] != 0 && error(gmsh.logger.getLastError())
+    return api_numElements_[]
+end
+const get_number_of_elements_by_type = getNumberOfElementsByType
+
+"""
+    gmsh.model.mesh.getElementsByTypeInBuffers(elementType, elementTags, nodeTags, tag = -1)
+
+Get the elements of type `elementType` classified on the entity of tag `tag`
+like `getElementsByType`, but write the element tags and the node tags directly
+into the caller-allocated buffers `elementTags` and `nodeTags`, of length at
+least `numElements` and `numElements` times the number of nodes per element,
+respectively (with `numElements` as returned by `getNumberOfElementsByType`). An
+empty buffer is not filled. See `getNodesInBuffers` for the buffer types in the
+bindings. The buffers are filled using `General.NumThreads` threads.
+
+Types:
+ - `elementType`: integer
+ - `elementTags`: buffer of sizes
+ - `nodeTags`: buffer of sizes
+ - `tag`: integer
+"""
+function getElementsByTypeInBuffers(elementType, elementTags, nodeTags, tag = -1)
+    ierr = Ref{Cint}()
+    ccall((:gmshModelMeshGetElementsByTypeInBuffers, gmsh.lib), Cvoid,
+          (Cint, Ptr{Csize_t}, Csize_t, Ptr{Csize_t}, Csize_t, Cint, Ptr{Cint}),
+          elementType, elementTags, length(elementTags), nodeTags, length(nodeTags), tag, ierr)
+    ierr[] != 0 && error(gmsh.logger.getLastError())
+    return nothing
+end
+const get_elements_by_type_in_buffers = getElementsByTypeInBuffers
+
 """
     gmsh.model.mesh.getMaxElementTag()
 
@@ -2668,6 +2841,40 @@ function getElementQualities(elementTags, qualityName = "minSICN", task = 0, num
 end
 const get_element_qualities = getElementQualities
 
+"""
+    gmsh.model.mesh.getElementQualitiesByType(elementType, qualityName = "minSICN", tag = -1)
+
+Get the quality `elementQualities` of all the elements of type `elementType`
+classified on the entity of tag `tag`, as well as their tags `elementTags`. If
+`tag` < 0, get the elements for all entities. `qualityName` is the requested
+quality measure (see `getElementQualities`). The measures are computed in
+parallel if possible, and are cached on the entities until the mesh changes.
+
+Return `elementTags`, `elementQualities`.
+
+Types:
+ - `elementType`: integer
+ - `elementTags`: vector of sizes
+ - `elementQualities`: vector of doubles
+ - `qualityName`: string
+ - `tag`: integer
+"""
+function getElementQualitiesByType(elementType, qualityName = "minSICN", tag = -1)
+    api_elementTags_ = Ref{Ptr{Csize_t}}()
+    api_elementTags_n_ = Ref{Csize_t}()
+    api_elementQualities_ = Ref{Ptr{Cdouble}}()
+    api_elementQualities_n_ = Ref{Csize_t}()
+    ierr = Ref{Cint}()
+    ccall((:gmshModelMeshGetElementQualitiesByType, gmsh.lib), Cvoid,
+          (Cint, Ptr{Ptr{Csize_t}}, Ptr{Csize_t}, Ptr{Ptr{Cdouble}}, Ptr{Csize_t}, Ptr{Cchar}, Cint, Ptr{Cint}),
+          elementType, api_elementTags_, api_elementTags_n_, api_elementQualities_, api_elementQualities_n_, qualityName, tag, ierr)
+    ierr[] != 0 && error(gmsh.logger.getLastError())
+    elementTags = unsafe_wrap(Array, api_elementTags_[], api_elementTags_n_[], own = true)
+    elementQualities = unsafe_wrap(Array, api_elementQualities_[], api_elementQualities_n_[], own = true)
+    return elementTags, elementQualities
+end
+const get_element_qualities_by_type = getElementQualitiesByType
+
 """
     gmsh.model.mesh.addElements(dim, tag, elementTypes, elementTags, nodeTags)
 
@@ -2782,7 +2989,8 @@ evaluation point: [e1g1, e1g2, ... e1gG, e2g1, ...]. `coord` contains for each
 element the x, y, z coordinates of the evaluation points. If `tag` < 0, get the
 Jacobian data for all entities. If `numTasks` > 1, only compute and return the
 part of the data indexed by `task` (for C++ only; output vectors must be
-preallocated).
+preallocated). Otherwise the computation is multithreaded using
+`General.NumThreads` threads.
 
 Return `jacobians`, `determinants`, `coord`.
 
@@ -2915,7 +3123,8 @@ tag `tag`. The arguments have the same meaning as in `getBasisFunctions`.
 index in the values returned by `getBasisFunctions`. For Lagrange basis
 functions the call is superfluous as it will return a vector of zeros. If
 `numTasks` > 1, only compute and return the part of the data indexed by `task`
-(for C++ only; output vector must be preallocated).
+(for C++ only; output vector must be preallocated). Otherwise the computation is
+multithreaded using `General.NumThreads` threads.
 
 Return `basisFunctionsOrientation`.
 
@@ -3332,7 +3541,8 @@ are taken into account for the barycenter calculation. If `fast` is set, the
 function returns the sum of the primary node coordinates (without normalizing by
 the number of nodes). If `tag` < 0, get the barycenters for all entities. If
 `numTasks` > 1, only compute and return the part of the data indexed by `task`
-(for C++ only; output vector must be preallocated).
+(for C++ only; output vector must be preallocated). Otherwise the computation is
+multithreaded using `General.NumThreads` threads.
 
 Return `barycenters`.
 
@@ -3368,7 +3578,8 @@ elements in the same order as in `getElements` and `getElementsByType`. If
 `primary` is set, only the primary (begin/end) nodes of the edges are returned.
 If `tag` < 0, get the edge nodes for all entities. If `numTasks` > 1, only
 compute and return the part of the data indexed by `task` (for C++ only; output
-vector must be preallocated).
+vector must be preallocated). Otherwise the computation is multithreaded using
+`General.NumThreads` threads.
 
 Return `nodeTags`.
 
@@ -3404,7 +3615,8 @@ element, with elements in the same order as in `getElements` and
 `getElementsByType`. If `primary` is set, only the primary (corner) nodes of the
 faces are returned. If `tag` < 0, get the face nodes for all entities. If
 `numTasks` > 1, only compute and return the part of the data indexed by `task`
-(for C++ only; output vector must be preallocated).
+(for C++ only; output vector must be preallocated). Otherwise the computation is
+multithreaded using `General.NumThreads` threads.
 
 Return `nodeTags`.
 
@@ -225,6 +225,20 @@ def _ivectorpair(o):
             raise Exception("Invalid data for input vector of pairs")
         return ((c_int * 2) * len(o))(*o), c_size_t(len(o) * 2)
 
+def _ibuffer(o, ctype):
+    if use_numpy and isinstance(o, numpy.ndarray):
+        dtype = numpy.uintp if ctype is c_size_t else numpy.float64
+        if(o.dtype != dtype or o.ndim != 1 or not o.flags.c_contiguous or
+           not o.flags.writeable):
+            raise Exception("Invalid buffer: expected a writeable contiguous "
+                            "1D array of type " + numpy.dtype(dtype).name)
+        return o.ctypes.data_as(POINTER(ctype)), c_size_t(o.size)
+    elif isinstance(o, Array) and o._type_ is ctype:
+        return cast(o, POINTER(ctype)), c_size_t(len(o))
+    else:
+        raise Exception("Invalid buffer: expected a numpy array or a ctypes "
+                        "array")
+
 def _ivectorstring(o):
     return (c_char_p * len(o))(*(s.encode() for s in o)), c_size_t(len(o))
 
@@ -1401,7 +1415,8 @@ class model:
         parametric coordinates on the curve) or 2 (with `parametricCoord'
         containing u, v parametric coordinates on the surface, concatenated: [p1u,
         p1v, p2u, ...]). Return x, y, z coordinates in `coord', concatenated: [p1x,
-        p1y, p1z, p2x, ...].
+        p1y, p1z, p2x, ...]. The points are evaluated using `General.NumThreads'
+        threads.
 
         Return `coord'.
 
@@ -1425,6 +1440,39 @@ class model:
         return _ovectordouble(api_coord_, api_coord_n_.value)
     get_value = getValue
 
+    @staticmethod
+    def getValueInBuffers(dim, tag, parametricCoord, coord):
+        """
+        gmsh.model.getValueInBuffers(dim, tag, parametricCoord, coord)
+
+        Evaluate the parametrization of the entity of dimension `dim' and tag `tag'
+        at the parametric coordinates `parametricCoord' like `getValue', but write
+        the x, y, z coordinates directly into the caller-allocated buffer `coord',
+        of length at least 3 times the number of points. This avoids any
+        intermediate copy of the result, e.g. when evaluating many points in a loop
+        from the Python, Julia or Fortran bindings (where the buffer should be a
+        contiguous array of doubles, e.g. a numpy array of type `numpy.float64' in
+        Python). The points are evaluated using `General.NumThreads' threads.
+
+        Types:
+        - `dim': integer
+        - `tag': integer
+        - `parametricCoord': vector of doubles
+        - `coord': buffer of doubles
+        """
+        api_parametricCoord_, api_parametricCoord_n_ = _ivectordouble(parametricCoord)
+        api_coord_, api_coord_n_ = _ibuffer(coord, c_double)
+        ierr = c_int()
+        lib.gmshModelGetValueInBuffers(
+            c_int(dim),
+            c_int(tag),
+            api_parametricCoord_, api_parametricCoord_n_,
+            api_coord_, api_coord_n_,
+            byref(ierr))
+        if ierr.value != 0:
+            raise Exception(logger.getLastError())
+    get_value_in_buffers = getValueInBuffers
+
     @staticmethod
     def getDerivative(dim, tag, parametricCoord):
         """
@@ -1438,7 +1486,8 @@ class model:
         For `dim' equal to 1 return the x, y, z components of the derivative with
         respect to u [d1ux, d1uy, d1uz, d2ux, ...]; for `dim' equal to 2 return the
         x, y, z components of the derivative with respect to u and v: [d1ux, d1uy,
-        d1uz, d1vx, d1vy, d1vz, d2ux, ...].
+        d1uz, d1vx, d1vy, d1vz, d2ux, ...]. The points are evaluated using
+        `General.NumThreads' threads.
 
         Return `derivatives'.
 
@@ -1477,7 +1526,8 @@ class model:
         d1uuz, d2uux, ...]; for `dim' equal to 2 return the x, y, z components of
         the second derivative with respect to u and v, and the mixed derivative
         with respect to u and v: [d1uux, d1uuy, d1uuz, d1vvx, d1vvy, d1vvz, d1uvx,
-        d1uvy, d1uvz, d2uux, ...].
+        d1uvy, d1uvz, d2uux, ...]. The points are evaluated using
+        `General.NumThreads' threads.
 
         Return `derivatives'.
 
@@ -1510,7 +1560,8 @@ class model:
         `tag' at the parametric coordinates `parametricCoord'. Only valid for `dim'
         equal to 1 (with `parametricCoord' containing parametric coordinates on the
         curve) or 2 (with `parametricCoord' containing u, v parametric coordinates
-        on the surface, concatenated: [p1u, p1v, p2u, ...]).
+        on the surface, concatenated: [p1u, p1v, p2u, ...]). The points are
+        evaluated using `General.NumThreads' threads.
 
         Return `curvatures'.
 
@@ -1542,7 +1593,8 @@ class model:
         Evaluate the principal curvatures of the surface with tag `tag' at the
         parametric coordinates `parametricCoord', as well as their respective
         directions. `parametricCoord' are given by pair of u and v coordinates,
-        concatenated: [p1u, p1v, p2u, ...].
+        concatenated: [p1u, p1v, p2u, ...]. The points are evaluated using
+        `General.NumThreads' threads.
 
         Return `curvatureMax', `curvatureMin', `directionMax', `directionMin'.
 
@@ -1586,6 +1638,7 @@ class model:
         `parametricCoord'. The `parametricCoord' vector should contain u and v
         coordinates, concatenated: [p1u, p1v, p2u, ...]. `normals' are returned as
         a vector of x, y, z components, concatenated: [n1x, n1y, n1z, n2x, ...].
+        The points are evaluated using `General.NumThreads' threads.
 
         Return `normals'.
 
@@ -1617,7 +1670,8 @@ class model:
         coordinates, concatenated: [p1x, p1y, p1z, p2x, ...]. `parametricCoord'
         returns the parametric coordinates t on the curve (if `dim' = 1) or u and v
         coordinates concatenated on the surface (if `dim' == 2), i.e. [p1t, p2t,
-        ...] or [p1u, p1v, p2u, ...].
+        ...] or [p1u, p1v, p2u, ...]. The points are evaluated using
+        `General.NumThreads' threads.
 
         Return `parametricCoord'.
 
@@ -1715,7 +1769,8 @@ class model:
         `closestCoord' are given as x, y, z coordinates, concatenated: [p1x, p1y,
         p1z, p2x, ...]. `parametricCoord' returns the parametric coordinates t on
         the curve (if `dim' == 1) or u and v coordinates concatenated on the
-        surface (if `dim' = 2), i.e. [p1t, p2t, ...] or [p1u, p1v, p2u, ...].
+        surface (if `dim' = 2), i.e. [p1t, p2t, ...] or [p1u, p1v, p2u, ...]. The
+        points are evaluated using `General.NumThreads' threads.
 
         Return `closestCoord', `parametricCoord'.
 
@@ -1744,6 +1799,41 @@ class model:
             _ovectordouble(api_parametricCoord_, api_parametricCoord_n_.value))
     get_closest_point = getClosestPoint
 
+    @staticmethod
+    def getClosestPointInBuffers(dim, tag, coord, closestCoord, parametricCoord):
+        """
+        gmsh.model.getClosestPointInBuffers(dim, tag, coord, closestCoord, parametricCoord)
+
+        Get the points on the entity of dimension `dim' and tag `tag' closest to
+        the points `coord' like `getClosestPoint', but write the coordinates and
+        the parametric coordinates of the closest points directly into the caller-
+        allocated buffers `closestCoord' and `parametricCoord', of length at least
+        3 times and `dim' times the number of points, respectively. An empty buffer
+        is not filled. See `getValueInBuffers' for the buffer types in the
+        bindings. The points are evaluated using `General.NumThreads' threads.
+
+        Types:
+        - `dim': integer
+        - `tag': integer
+        - `coord': vector of doubles
+        - `closestCoord': buffer of doubles
+        - `parametricCoord': buffer of doubles
+        """
+        api_coord_, api_coord_n_ = _ivectordouble(coord)
+        api_closestCoord_, api_closestCoord_n_ = _ibuffer(closestCoord, c_double)
+        api_parametricCoord_, api_parametricCoord_n_ = _ibuffer(parametricCoord, c_double)
+        ierr = c_int()
+        lib.gmshModelGetClosestPointInBuffers(
+            c_int(dim),
+            c_int(tag),
+            api_coord_, api_coord_n_,
+            api_closestCoord_, api_closestCoord_n_,
+            api_parametricCoord_, api_parametricCoord_n_,
+            byref(ierr))
+        if ierr.value != 0:
+            raise Exception(logger.getLastError())
+    get_closest_point_in_buffers = getClosestPointInBuffers
+
     @staticmethod
     def reparametrizeOnSurface(dim, tag, parametricCoord, surfaceTag, which=0):
         """
@@ -1754,7 +1844,8 @@ class model:
         reparametrize all the points corresponding to the parametric coordinates
         `parametricCoord'. Multiple matches in case of periodic surfaces can be
         selected with `which'. This feature is only available for a subset of
-        entities, depending on the underlying geometrical representation.
+        entities, depending on the underlying geometrical representation. The
+        points are evaluated using `General.NumThreads' threads.
 
         Return `surfaceParametricCoord'.
 
@@ -2385,6 +2476,72 @@ class model:
                 _ovectordouble(api_parametricCoord_, api_parametricCoord_n_.value))
         get_nodes = getNodes
 
+        @staticmethod
+        def getNumberOfNodes(dim=-1, tag=-1):
+            """
+            gmsh.model.mesh.getNumberOfNodes(dim=-1, tag=-1)
+
+            Get the number of nodes `numNodes' classified on the entity of dimension
+            `dim' and tag `tag'. If `tag' < 0, count the nodes for all entities of
+            dimension `dim'. If `dim' and `tag' are negative, count all the nodes in
+            the mesh. Can be used to allocate the buffers passed to
+            `getNodesInBuffers'.
+
+            Return `numNodes'.
+
+            Types:
+            - `numNodes': size
+            - `dim': integer
+            - `tag': integer
+            """
+            api_numNodes_ = c_size_t()
+            ierr = c_int()
+            lib.gmshModelMeshGetNumberOfNodes(
+                byref(api_numNodes_),
+                c_int(dim),
+                c_int(tag),
+                byref(ierr))
+            if ierr.value != 0:
+                raise Exception(logger.getLastError())
+            return api_numNodes_.value
+        get_number_of_nodes = getNumberOfNodes
+
+        @staticmethod
+        def getNodesInBuffers(nodeTags, coord, dim=-1, tag=-1):
+            """
+            gmsh.model.mesh.getNodesInBuffers(nodeTags, coord, dim=-1, tag=-1)
+
+            Get the nodes classified on the entity of dimension `dim' and tag `tag'
+            like `getNodes' (without the boundary nodes and the parametric
+            coordinates), but write the node tags and coordinates directly into the
+            caller-allocated buffers `nodeTags' and `coord', of length at least
+            `numNodes' and 3 times `numNodes', respectively (with `numNodes' as
+            returned by `getNumberOfNodes'). An empty buffer is not filled. This avoids
+            any intermediate copy of the data between the library and the caller, in
+            particular in the Python, Julia and Fortran bindings (where the buffers
+            should be contiguous arrays of the right type, e.g. numpy arrays of type
+            `numpy.uintp' and `numpy.float64' in Python). The buffers are filled using
+            `General.NumThreads' threads.
+
+            Types:
+            - `nodeTags': buffer of sizes
+            - `coord': buffer of doubles
+            - `dim': integer
+            - `tag': integer
+            """
+            api_nodeTags_, api_nodeTags_n_ = _ibuffer(nodeTags, c_size_t)
+            api_coord_, api_coord_n_ = _ibuffer(coord, c_double)
+            ierr = c_int()
+            lib.gmshModelMeshGetNodesInBuffers(
+                api_nodeTags_, api_nodeTags_n_,
+                api_coord_, api_coord_n_,
+                c_int(dim),
+                c_int(tag),
+                byref(ierr))
+            if ierr.value != 0:
+                raise Exception(logger.getLastError())
+        get_nodes_in_buffers = getNodesInBuffers
+
         @staticmethod
         def getNodesByElementType(elementType, tag=-1, returnParametricCoord=True):
             """
@@ -3004,7 +3161,8 @@ class model:
             this type of element, that contains the node tags of all the elements of
             the given type, concatenated: [e1n1, e1n2, ..., e1nN, e2n1, ...]. If
             `numTasks' > 1, only compute and return the part of the data indexed by
-            `task' (for C++ only; output vectors must be preallocated).
+            `task' (for C++ only; output vectors must be preallocated). Otherwise the
+            computation is multithreaded using `General.NumThreads' threads.
 
             Return `elementTags', `nodeTags'.
 
@@ -3034,6 +3192,68 @@ class model:
                 _ovectorsize(api_nodeTags_, api_nodeTags_n_.value))
         get_elements_by_type = getElementsByType
 
+        @staticmethod
+        def getNumberOfElementsByType(elementType, tag=-1):
+            """
+            gmsh.model.mesh.getNumberOfElementsByType(elementType, tag=-1)
+
+            Get the number of elements `numElements' of type `elementType' classified
+            on the entity of tag `tag'. If `tag' < 0, count the elements for all
+            entities. Can be used to allocate the buffers passed to
+            `getElementsByTypeInBuffers'.
+
+            Return `numElements'.
+
+            Types:
+            - `elementType': integer
+            - `numElements': size
+            - `tag': integer
+            """
+            api_numElements_ = c_size_t()
+            ierr = c_int()
+            lib.gmshModelMeshGetNumberOfElementsByType(
+                c_int(elementType),
+                byref(api_numElements_),
+                c_int(tag),
+                byref(ierr))
+            if ierr.value != 0:
+                raise Exception(logger.getLastError())
+            return api_numElements_.value
+        get_number_of_elements_by_type = getNumberOfElementsByType
+
+        @staticmethod
+        def getElementsByTypeInBuffers(elementType, elementTags, nodeTags, tag=-1):
+            """
+            gmsh.model.mesh.getElementsByTypeInBuffers(elementType, elementTags, nodeTags, tag=-1)
+
+            Get the elements of type `elementType' classified on the entity of tag
+            `tag' like `getElementsByType', but write the element tags and the node
+            tags directly into the caller-allocated buffers `elementTags' and
+            `nodeTags', of length at least `numElements' and `numElements' times the
+            number of nodes per element, respectively (with `numElements' as returned
+            by `getNumberOfElementsByType'). An empty buffer is not filled. See
+            `getNodesInBuffers' for the buffer types in the bindings. The buffers are
+            filled using `General.NumThreads' threads.
+
+            Types:
+            - `elementType': integer
+            - `elementTags': buffer of sizes
+            - `nodeTags': buffer of sizes
+            - `tag': integer
+            """
+            api_elementTags_, api_elementTags_n_ = _ibuffer(elementTags, c_size_t)
+            api_nodeTags_, api_nodeTags_n_ = _ibuffer(nodeTags, c_size_t)
+            ierr = c_int()
+            lib.gmshModelMeshGetElementsByTypeInBuffers(
+                c_int(elementType),
+                api_elementTags_, api_elementTags_n_,
+                api_nodeTags_, api_nodeTags_n_,
+                c_int(tag),
+                byref(ierr))
+            if ierr.value != 0:
+                raise Exception(logger.getLastError())
+        get_elements_by_type_in_buffers = getElementsByTypeInBuffers
+
         @staticmethod
         def getMaxElementTag():
             """
@@ -3099,6 +3319,44 @@ class model:
             return _ovectordouble(api_elementsQuality_, api_elementsQuality_n_.value)
         get_element_qualities = getElementQualities
 
+        @staticmethod
+        def getElementQualitiesByType(elementType, qualityName="minSICN", tag=-1):
+            """
+            gmsh.model.mesh.getElementQualitiesByType(elementType, qualityName="minSICN", tag=-1)
+
+            Get the quality `elementQualities' of all the elements of type
+            `elementType' classified on the entity of tag `tag', as well as their tags
+            `elementTags'. If `tag' < 0, get the elements for all entities.
+            `qualityName' is the requested quality measure (see `getElementQualities').
+            The measures are computed in parallel if possible, and are cached on the
+            entities until the mesh changes.
+
+            Return `elementTags', `elementQualities'.
+
+            Types:
+            - `elementType': integer
+            - `elementTags': vector of sizes
+            - `elementQualities': vector of doubles
+            - `qualityName': string
+            - `tag': integer
+            """
+            api_elementTags_, api_elementTags_n_ = POINTER(c_size_t)(), c_size_t()
+            api_elementQualities_, api_elementQualities_n_ = POINTER(c_double)(), c_size_t()
+            ierr = c_int()
+            lib.gmshModelMeshGetElementQualitiesByType(
+                c_int(elementType),
+                byref(api_elementTags_), byref(api_elementTags_n_),
+                byref(api_elementQualities_), byref(api_elementQualities_n_),
+                c_char_p(qualityName.encode()),
+                c_int(tag),
+                byref(ierr))
+            if ierr.value != 0:
+                raise Exception(logger.getLastError())
+            return (
+                _ovectorsize(api_elementTags_, api_elementTags_n_.value),
+                _ovectordouble(api_elementQualities_, api_elementQualities_n_.value))
+        get_element_qualities_by_type = getElementQualitiesByType
+
         @staticmethod
         def addElements(dim, tag, elementTypes, elementTags, nodeTags):
             """
@@ -3230,7 +3488,8 @@ class model:
             coordinates of the evaluation points. If `tag' < 0, get the Jacobian data
             for all entities. If `numTasks' > 1, only compute and return the part of
             the data indexed by `task' (for C++ only; output vectors must be
-            preallocated).
+            preallocated). Otherwise the computation is multithreaded using
+            `General.NumThreads' threads.
 
             Return `jacobians', `determinants', `coord'.
 
@@ -3385,7 +3644,8 @@ class model:
             `getBasisFunctions'. For Lagrange basis functions the call is superfluous
             as it will return a vector of zeros. If `numTasks' > 1, only compute and
             return the part of the data indexed by `task' (for C++ only; output vector
-            must be preallocated).
+            must be preallocated). Otherwise the computation is multithreaded using
+            `General.NumThreads' threads.
 
             Return `basisFunctionsOrientation'.
 
@@ -3838,7 +4098,8 @@ class model:
             (without normalizing by the number of nodes). If `tag' < 0, get the
             barycenters for all entities. If `numTasks' > 1, only compute and return
             the part of the data indexed by `task' (for C++ only; output vector must be
-            preallocated).
+            preallocated). Otherwise the computation is multithreaded using
+            `General.NumThreads' threads.
 
             Return `barycenters'.
 
@@ -3880,6 +4141,8 @@ class model:
             nodes of the edges are returned. If `tag' < 0, get the edge nodes for all
             entities. If `numTasks' > 1, only compute and return the part of the data
             indexed by `task' (for C++ only; output vector must be preallocated).
+            Otherwise the computation is multithreaded using `General.NumThreads'
+            threads.
 
             Return `nodeTags'.
 
@@ -3920,6 +4183,8 @@ class model:
             of the faces are returned. If `tag' < 0, get the face nodes for all
             entities. If `numTasks' > 1, only compute and return the part of the data
             indexed by `task' (for C++ only; output vector must be preallocated).
+            Otherwise the computation is multithreaded using `General.NumThreads'
+            threads.
 
             Return `nodeTags'.
 
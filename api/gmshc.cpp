@@ -676,6 +676,18 @@ GMSH_API void gmshModelGetValue(const int dim, const int tag, const double * par
   }
 }
 
+GMSH_API void gmshModelGetValueInBuffers(const int dim, const int tag, const double * parametricCoord, const size_t parametricCoord_n, double * coord, const size_t coord_n, int * ierr)
+{
+  if(ierr) *ierr = 0;
+  try {
+    std::vector<double> api_parametricCoord_(parametricCoord, parametricCoord + parametricCoord_n);
+    gmsh::model::getValueInBuffers(dim, tag, api_parametricCoord_, coord, coord_n);
+  }
+  catch(...){
+    if(ierr) *ierr = 1;
+  }
+}
+
 GMSH_API void gmshModelGetDerivative(const int dim, const int tag, const double * parametricCoord, const size_t parametricCoord_n, double ** derivatives, size_t * derivatives_n, int * ierr)
 {
   if(ierr) *ierr = 0;
@@ -811,6 +823,18 @@ GMSH_API void gmshModelGetClosestPoint(const int dim, const int tag, const doubl
   }
 }
 
+GMSH_API void gmshModelGetClosestPointInBuffers(const int dim, const int tag, const double * coord, const size_t coord_n, double * closestCoord, const size_t closestCoord_n, double * parametricCoord, const size_t parametricCoord_n, int * ierr)
+{
+  if(ierr) *ierr = 0;
+  try {
+    std::vector<double> api_coord_(coord, coord + coord_n);
+    gmsh::model::getClosestPointInBuffers(dim, tag, api_coord_, closestCoord, closestCoord_n, parametricCoord, parametricCoord_n);
+  }
+  catch(...){
+    if(ierr) *ierr = 1;
+  }
+}
+
 GMSH_API void gmshModelReparametrizeOnSurface(const int dim, const int tag, const double * parametricCoord, const size_t parametricCoord_n, const int surfaceTag, double ** surfaceParametricCoord, size_t * surfaceParametricCoord_n, const int which, int * ierr)
 {
   if(ierr) *ierr = 0;
@@ -1150,6 +1174,28 @@ GMSH_API void gmshModelMeshGetNodes(size_t ** nodeTags, size_t * nodeTags_n, dou
   }
 }
 
+GMSH_API void gmshModelMeshGetNumberOfNodes(size_t * numNodes, const int dim, const int tag, int * ierr)
+{
+  if(ierr) *ierr = 0;
+  try {
+    gmsh::model::mesh::getNumberOfNodes(*numNodes, dim, tag);
+  }
+  catch(...){
+    if(ierr) *ierr = 1;
+  }
+}
+
+GMSH_API void gmshModelMeshGetNodesInBuffers(size_t * nodeTags, const size_t nodeTags_n, double * coord, const size_t coord_n, const int dim, const int tag, int * ierr)
+{
+  if(ierr) *ierr = 0;
+  try {
+    gmsh::model::mesh::getNodesInBuffers(nodeTags, nodeTags_n, coord, coord_n, dim, tag);
+  }
+  catch(...){
+    if(ierr) *ierr = 1;
+  }
+}
+
 GMSH_API void gmshModelMeshGetNodesByElementType(const int elementType, size_t ** nodeTags, size_t * nodeTags_n, double ** coord, size_t * coord_n, double ** parametricCoord, size_t * parametricCoord_n, const int tag, const int returnParametricCoord, int * ierr)
 {
   if(ierr) *ierr = 0;
@@ -1402,6 +1448,28 @@ GMSH_API void gmshModelMeshGetElementsByType(const int elementType, size_t ** el
   }
 }
 
+GMSH_API void gmshModelMeshGetNumberOfElementsByType(const int elementType, size_t * numElements, const int tag, int * ierr)
+{
+  if(ierr) *ierr = 0;
+  try {
+    gmsh::model::mesh::getNumberOfElementsByType(elementType, *numElements, tag);
+  }
+  catch(...){
+    if(ierr) *ierr = 1;
+  }
+}
+
+GMSH_API void gmshModelMeshGetElementsByTypeInBuffers(const int elementType, size_t * elementTags, const size_t elementTags_n, size_t * nodeTags, const size_t nodeTags_n, const int tag, int * ierr)
+{
+  if(ierr) *ierr = 0;
+  try {
+    gmsh::model::mesh::getElementsByTypeInBuffers(elementType, elementTags, elementTags_n, nodeTags, nodeTags_n, tag);
+  }
+  catch(...){
+    if(ierr) *ierr = 1;
+  }
+}
+
 GMSH_API void gmshModelMeshGetMaxElementTag(size_t * maxTag, int * ierr)
 {
   if(ierr) *ierr = 0;
@@ -1442,6 +1510,21 @@ GMSH_API void gmshModelMeshGetElementQualities(const size_t * elementTags, const
   }
 }
 
+GMSH_API void gmshModelMeshGetElementQualitiesByType(const int elementType, size_t ** elementTags, size_t * elementTags_n, double ** elementQualities, size_t * elementQualities_n, const char * qualityName, const int tag, int * ierr)
+{
+  if(ierr) *ierr = 0;
+  try {
+    std::vector<std::size_t> api_elementTags_;
+    std::vector<double> api_elementQualities_;
+    gmsh::model::mesh::getElementQualitiesByType(elementType, api_elementTags_, api_elementQualities_, qualityName, tag);
+    vector2ptr(api_elementTags_, elementTags, elementTags_n);
+    vector2ptr(api_elementQualities_, elementQualities, elementQualities_n);
+  }
+  catch(...){
+    if(ierr) *ierr = 1;
+  }
+}
+
 GMSH_API void gmshModelMeshAddElements(const int dim, const int tag, const int * elementTypes, const size_t elementTypes_n, const size_t * const * elementTags, const size_t * elementTags_n, const size_t elementTags_nn, const size_t * const * nodeTags, const size_t * nodeTags_n, const size_t nodeTags_nn, int * ierr)
 {
   if(ierr) *ierr = 0;
@@ -374,13 +374,28 @@ GMSH_API void gmshModelGetPartitions(const int dim,
  * parametric coordinates on the curve) or 2 (with `parametricCoord'
  * containing u, v parametric coordinates on the surface, concatenated: [p1u,
  * p1v, p2u, ...]). Return x, y, z coordinates in `coord', concatenated: [p1x,
- * p1y, p1z, p2x, ...]. */
+ * p1y, p1z, p2x, ...]. The points are evaluated using `General.NumThreads'
+ * threads. */
 GMSH_API void gmshModelGetValue(const int dim,
                                 const int tag,
                                 const double * parametricCoord, const size_t parametricCoord_n,
                                 double ** coord, size_t * coord_n,
                                 int * ierr);
 
+/* Evaluate the parametrization of the entity of dimension `dim' and tag `tag'
+ * at the parametric coordinates `parametricCoord' like `getValue', but write
+ * the x, y, z coordinates directly into the caller-allocated buffer `coord',
+ * of length at least 3 times the number of points. This avoids any
+ * intermediate copy of the result, e.g. when evaluating many points in a loop
+ * from the Python, Julia or Fortran bindings (where the buffer should be a
+ * contiguous array of doubles, e.g. a numpy array of type `numpy.float64' in
+ * Python). The points are evaluated using `General.NumThreads' threads. */
+GMSH_API void gmshModelGetValueInBuffers(const int dim,
+                                         const int tag,
+                                         const double * parametricCoord, const size_t parametricCoord_n,
+                                         double * coord, const size_t coord_n,
+                                         int * ierr);
+
 /* Evaluate the derivative of the parametrization of the entity of dimension
  * `dim' and tag `tag' at the parametric coordinates `parametricCoord'. Only
  * valid for `dim' equal to 1 (with `parametricCoord' containing parametric
@@ -389,7 +404,8 @@ GMSH_API void gmshModelGetValue(const int dim,
  * For `dim' equal to 1 return the x, y, z components of the derivative with
  * respect to u [d1ux, d1uy, d1uz, d2ux, ...]; for `dim' equal to 2 return the
  * x, y, z components of the derivative with respect to u and v: [d1ux, d1uy,
- * d1uz, d1vx, d1vy, d1vz, d2ux, ...]. */
+ * d1uz, d1vx, d1vy, d1vz, d2ux, ...]. The points are evaluated using
+ * `General.NumThreads' threads. */
 GMSH_API void gmshModelGetDerivative(const int dim,
                                      const int tag,
                                      const double * parametricCoord, const size_t parametricCoord_n,
@@ -406,7 +422,8 @@ GMSH_API void gmshModelGetDerivative(const int dim,
  * d1uuz, d2uux, ...]; for `dim' equal to 2 return the x, y, z components of
  * the second derivative with respect to u and v, and the mixed derivative
  * with respect to u and v: [d1uux, d1uuy, d1uuz, d1vvx, d1vvy, d1vvz, d1uvx,
- * d1uvy, d1uvz, d2uux, ...]. */
+ * d1uvy, d1uvz, d2uux, ...]. The points are evaluated using
+ * `General.NumThreads' threads. */
 GMSH_API void gmshModelGetSecondDerivative(const int dim,
                                            const int tag,
                                            const double * parametricCoord, const size_t parametricCoord_n,
@@ -417,7 +434,8 @@ GMSH_API void gmshModelGetSecondDerivative(const int dim,
  * `tag' at the parametric coordinates `parametricCoord'. Only valid for `dim'
  * equal to 1 (with `parametricCoord' containing parametric coordinates on the
  * curve) or 2 (with `parametricCoord' containing u, v parametric coordinates
- * on the surface, concatenated: [p1u, p1v, p2u, ...]). */
+ * on the surface, concatenated: [p1u, p1v, p2u, ...]). The points are
+ * evaluated using `General.NumThreads' threads. */
 GMSH_API void gmshModelGetCurvature(const int dim,
                                     const int tag,
                                     const double * parametricCoord, const size_t parametricCoord_n,
@@ -427,7 +445,8 @@ GMSH_API void gmshModelGetCurvature(const int dim,
 /* Evaluate the principal curvatures of the surface with tag `tag' at the
  * parametric coordinates `parametricCoord', as well as their respective
  * directions. `parametricCoord' are given by pair of u and v coordinates,
- * concatenated: [p1u, p1v, p2u, ...]. */
+ * concatenated: [p1u, p1v, p2u, ...]. The points are evaluated using
+ * `General.NumThreads' threads. */
 GMSH_API void gmshModelGetPrincipalCurvatures(const int tag,
                                               const double * parametricCoord, const size_t parametricCoord_n,
                                               double ** curvatureMax, size_t * curvatureMax_n,
@@ -439,7 +458,8 @@ GMSH_API void gmshModelGetPrincipalCurvatures(const int tag,
 /* Get the normal to the surface with tag `tag' at the parametric coordinates
  * `parametricCoord'. The `parametricCoord' vector should contain u and v
  * coordinates, concatenated: [p1u, p1v, p2u, ...]. `normals' are returned as
- * a vector of x, y, z components, concatenated: [n1x, n1y, n1z, n2x, ...]. */
+ * a vector of x, y, z components, concatenated: [n1x, n1y, n1z, n2x, ...].
+ * The points are evaluated using `General.NumThreads' threads. */
 GMSH_API void gmshModelGetNormal(const int tag,
                                  const double * parametricCoord, const size_t parametricCoord_n,
                                  double ** normals, size_t * normals_n,
@@ -450,7 +470,8 @@ GMSH_API void gmshModelGetNormal(const int tag,
  * coordinates, concatenated: [p1x, p1y, p1z, p2x, ...]. `parametricCoord'
  * returns the parametric coordinates t on the curve (if `dim' = 1) or u and v
  * coordinates concatenated on the surface (if `dim' == 2), i.e. [p1t, p2t,
- * ...] or [p1u, p1v, p2u, ...]. */
+ * ...] or [p1u, p1v, p2u, ...]. The points are evaluated using
+ * `General.NumThreads' threads. */
 GMSH_API void gmshModelGetParametrization(const int dim,
                                           const int tag,
                                           const double * coord, const size_t coord_n,
@@ -481,7 +502,8 @@ GMSH_API int gmshModelIsInside(const int dim,
  * `closestCoord' are given as x, y, z coordinates, concatenated: [p1x, p1y,
  * p1z, p2x, ...]. `parametricCoord' returns the parametric coordinates t on
  * the curve (if `dim' == 1) or u and v coordinates concatenated on the
- * surface (if `dim' = 2), i.e. [p1t, p2t, ...] or [p1u, p1v, p2u, ...]. */
+ * surface (if `dim' = 2), i.e. [p1t, p2t, ...] or [p1u, p1v, p2u, ...]. The
+ * points are evaluated using `General.NumThreads' threads. */
 GMSH_API void gmshModelGetClosestPoint(const int dim,
                                        const int tag,
                                        const double * coord, const size_t coord_n,
@@ -489,12 +511,27 @@ GMSH_API void gmshModelGetClosestPoint(const int dim,
                                        double ** parametricCoord, size_t * parametricCoord_n,
                                        int * ierr);
 
+/* Get the points on the entity of dimension `dim' and tag `tag' closest to
+ * the points `coord' like `getClosestPoint', but write the coordinates and
+ * the parametric coordinates of the closest points directly into the caller-
+ * allocated buffers `closestCoord' and `parametricCoord', of length at least
+ * 3 times and `dim' times the number of points, respectively. An empty buffer
+ * is not filled. See `getValueInBuffers' for the buffer types in the
+ * bindings. The points are evaluated using `General.NumThreads' threads. */
+GMSH_API void gmshModelGetClosestPointInBuffers(const int dim,
+                                                const int tag,
+                                                const double * coord, const size_t coord_n,
+                                                double * closestCoord, const size_t closestCoord_n,
+                                                double * parametricCoord, const size_t parametricCoord_n,
+                                                int * ierr);
+
 /* Reparametrize the boundary entity (point or curve, i.e. with `dim' == 0 or
  * `dim' == 1) of tag `tag' on the surface `surfaceTag'. If `dim' == 1,
  * reparametrize all the points corresponding to the parametric coordinates
  * `parametricCoord'. Multiple matches in case of periodic surfaces can be
  * selected with `which'. This feature is only available for a subset of
- * entities, depending on the underlying geometrical representation. */
+ * entities, depending on the underlying geometrical representation. The
+ * points are evaluated using `General.NumThreads' threads. */
 GMSH_API void gmshModelReparametrizeOnSurface(const int dim,
                                               const int tag,
                                               const double * parametricCoord, const size_t parametricCoord_n,
@@ -681,6 +718,33 @@ GMSH_API void gmshModelMeshGetNodes(size_t ** nodeTags, size_t * nodeTags_n,
                                     const int returnParametricCoord,
                                     int * ierr);
 
+/* Get the number of nodes `numNodes' classified on the entity of dimension
+ * `dim' and tag `tag'. If `tag' < 0, count the nodes for all entities of
+ * dimension `dim'. If `dim' and `tag' are negative, count all the nodes in
+ * the mesh. Can be used to allocate the buffers passed to
+ * `getNodesInBuffers'. */
+GMSH_API void gmshModelMeshGetNumberOfNodes(size_t * numNodes,
+                                            const int dim,
+                                            const int tag,
+                                            int * ierr);
+
+/* Get the nodes classified on the entity of dimension `dim' and tag `tag'
+ * like `getNodes' (without the boundary nodes and the parametric
+ * coordinates), but write the node tags and coordinates directly into the
+ * caller-allocated buffers `nodeTags' and `coord', of length at least
+ * `numNodes' and 3 times `numNodes', respectively (with `numNodes' as
+ * returned by `getNumberOfNodes'). An empty buffer is not filled. This avoids
+ * any intermediate copy of the data between the library and the caller, in
+ * particular in the Python, Julia and Fortran bindings (where the buffers
+ * should be contiguous arrays of the right type, e.g. numpy arrays of type
+ * `numpy.uintp' and `numpy.float64' in Python). The buffers are filled using
+ * `General.NumThreads' threads. */
+GMSH_API void gmshModelMeshGetNodesInBuffers(size_t * nodeTags, const size_t nodeTags_n,
+                                             double * coord, const size_t coord_n,
+                                             const int dim,
+                                             const int tag,
+                                             int * ierr);
+
 /* Get the nodes classified on the entity of tag `tag', for all the elements
  * of type `elementType'. The other arguments are treated as in `getNodes'. */
 GMSH_API void gmshModelMeshGetNodesByElementType(const int elementType,
@@ -882,7 +946,8 @@ GMSH_API void gmshModelMeshGetElementProperties(const int elementType,
  * this type of element, that contains the node tags of all the elements of
  * the given type, concatenated: [e1n1, e1n2, ..., e1nN, e2n1, ...]. If
  * `numTasks' > 1, only compute and return the part of the data indexed by
- * `task' (for C++ only; output vectors must be preallocated). */
+ * `task' (for C++ only; output vectors must be preallocated). Otherwise the
+ * computation is multithreaded using `General.NumThreads' threads. */
 GMSH_API void gmshModelMeshGetElementsByType(const int elementType,
                                              size_t ** elementTags, size_t * elementTags_n,
                                              size_t ** nodeTags, size_t * nodeTags_n,
@@ -891,6 +956,29 @@ GMSH_API void gmshModelMeshGetElementsByType(const int elementType,
                                              const size_t numTasks,
                                              int * ierr);
 
+/* Get the number of elements `numElements' of type `elementType' classified
+ * on the entity of tag `tag'. If `tag' < 0, count the elements for all
+ * entities. Can be used to allocate the buffers passed to
+ * `getElementsByTypeInBuffers'. */
+GMSH_API void gmshModelMeshGetNumberOfElementsByType(const int elementType,
+                                                     size_t * numElements,
+                                                     const int tag,
+                                                     int * ierr);
+
+/* Get the elements of type `elementType' classified on the entity of tag
+ * `tag' like `getElementsByType', but write the element tags and the node
+ * tags directly into the caller-allocated buffers `elementTags' and
+ * `nodeTags', of length at least `numElements' and `numElements' times the
+ * number of nodes per element, respectively (with `numElements' as returned
+ * by `getNumberOfElementsByType'). An empty buffer is not filled. See
+ * `getNodesInBuffers' for the buffer types in the bindings. The buffers are
+ * filled using `General.NumThreads' threads. */
+GMSH_API void gmshModelMeshGetElementsByTypeInBuffers(const int elementType,
+                                                      size_t * elementTags, const size_t elementTags_n,
+                                                      size_t * nodeTags, const size_t nodeTags_n,
+                                                      const int tag,
+                                                      int * ierr);
+
 /* Get the maximum tag `maxTag' of an element in the mesh. */
 GMSH_API void gmshModelMeshGetMaxElementTag(size_t * maxTag,
                                             int * ierr);
@@ -925,6 +1013,19 @@ GMSH_API void gmshModelMeshGetElementQualities(const size_t * elementTags, const
                                                const size_t numTasks,
                                                int * ierr);
 
+/* Get the quality `elementQualities' of all the elements of type
+ * `elementType' classified on the entity of tag `tag', as well as their tags
+ * `elementTags'. If `tag' < 0, get the elements for all entities.
+ * `qualityName' is the requested quality measure (see `getElementQualities').
+ * The measures are computed in parallel if possible, and are cached on the
+ * entities until the mesh changes. */
+GMSH_API void gmshModelMeshGetElementQualitiesByType(const int elementType,
+                                                     size_t ** elementTags, size_t * elementTags_n,
+                                                     double ** elementQualities, size_t * elementQualities_n,
+                                                     const char * qualityName,
+                                                     const int tag,
+                                                     int * ierr);
+
 /* Add elements classified on the entity of dimension `dim' and tag `tag'.
  * `types' contains the MSH types of the elements (e.g. `2' for 3-node
  * triangles: see the Gmsh reference manual). `elementTags' is a vector of the
@@ -987,7 +1088,8 @@ GMSH_API void gmshModelMeshGetIntegrationPoints(const int elementType,
  * coordinates of the evaluation points. If `tag' < 0, get the Jacobian data
  * for all entities. If `numTasks' > 1, only compute and return the part of
  * the data indexed by `task' (for C++ only; output vectors must be
- * preallocated). */
+ * preallocated). Otherwise the computation is multithreaded using
+ * `General.NumThreads' threads. */
 GMSH_API void gmshModelMeshGetJacobians(const int elementType,
                                         const double * localCoord, const size_t localCoord_n,
                                         double ** jacobians, size_t * jacobians_n,
@@ -1065,7 +1167,8 @@ GMSH_API void gmshModelMeshGetBasisFunctions(const int elementType,
  * `getBasisFunctions'. For Lagrange basis functions the call is superfluous
  * as it will return a vector of zeros. If `numTasks' > 1, only compute and
  * return the part of the data indexed by `task' (for C++ only; output vector
- * must be preallocated). */
+ * must be preallocated). Otherwise the computation is multithreaded using
+ * `General.NumThreads' threads. */
 GMSH_API void gmshModelMeshGetBasisFunctionsOrientation(const int elementType,
                                                         const char * functionSpaceType,
                                                         int ** basisFunctionsOrientation, size_t * basisFunctionsOrientation_n,
@@ -1206,7 +1309,8 @@ GMSH_API void gmshModelMeshGetKeysInformation(const int * typeKeys, const size_t
  * (without normalizing by the number of nodes). If `tag' < 0, get the
  * barycenters for all entities. If `numTasks' > 1, only compute and return
  * the part of the data indexed by `task' (for C++ only; output vector must be
- * preallocated). */
+ * preallocated). Otherwise the computation is multithreaded using
+ * `General.NumThreads' threads. */
 GMSH_API void gmshModelMeshGetBarycenters(const int elementType,
                                           const int tag,
                                           const int fast,
@@ -1230,7 +1334,9 @@ GMSH_API void gmshModelMeshPreallocateBarycenters(const int elementType,
  * `getElementsByType'. If `primary' is set, only the primary (begin/end)
  * nodes of the edges are returned. If `tag' < 0, get the edge nodes for all
  * entities. If `numTasks' > 1, only compute and return the part of the data
- * indexed by `task' (for C++ only; output vector must be preallocated). */
+ * indexed by `task' (for C++ only; output vector must be preallocated).
+ * Otherwise the computation is multithreaded using `General.NumThreads'
+ * threads. */
 GMSH_API void gmshModelMeshGetElementEdgeNodes(const int elementType,
                                                size_t ** nodeTags, size_t * nodeTags_n,
                                                const int tag,
@@ -1247,7 +1353,9 @@ GMSH_API void gmshModelMeshGetElementEdgeNodes(const int elementType,
  * `getElementsByType'. If `primary' is set, only the primary (corner) nodes
  * of the faces are returned. If `tag' < 0, get the face nodes for all
  * entities. If `numTasks' > 1, only compute and return the part of the data
- * indexed by `task' (for C++ only; output vector must be preallocated). */
+ * indexed by `task' (for C++ only; output vector must be preallocated).
+ * Otherwise the computation is multithreaded using `General.NumThreads'
+ * threads. */
 GMSH_API void gmshModelMeshGetElementFaceNodes(const int elementType,
                                                const int faceType,
                                                size_t ** nodeTags, size_t * nodeTags_n,
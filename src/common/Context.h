@@ -59,6 +59,7 @@ struct contextMeshOptions {
   double mshFileVersion, medFileMinorVersion, scalingFactor;
   int medImportGroupsOfNodes, medSingleModel;
   int saveAll, saveTri, saveGroupsOfNodes, saveGroupsOfElements;
+  int compactConnectivity;
   int readGroupsOfElements;
   int binary, bdfFieldFormat;
   int unvStrictFormat, stlRemoveDuplicateTriangles, stlOneSolidPerSurface;
@@ -87,6 +88,7 @@ struct contextMeshOptions {
   int nodeLabels, lineLabels, surfaceLabels, volumeLabels, qualityType, labelType;
   double nodeSize, lineWidth;
   int dual, voronoi, drawSkinOnly, colorCarousel, labelSampling;
+  int levelOfDetail;
   int smoothNormals, clip;
 };
 
@@ -129,6 +131,7 @@ struct contextGeometryOptions {
   double matchMeshTolerance;
   int orientedPhysicals;
   int reparamOnFaceRobust;
+  int projectionCacheSize;
   // geometry display
   int draw, light, lightTwoSide, points, curves, surfaces, volumes;
   int pointLabels, curveLabels, surfaceLabels, volumeLabels, labelType;
@@ -338,7 +341,7 @@ public:
     int smooth, animCycle, animStep;
     int combineTime, combineRemoveOrig, combineCopyOptions;
     int fileFormat, plugins, forceNodeData, forceElementData;
-    int saveMesh, saveInterpolationMatrices;
+    int saveMesh, saveInterpolationMatrices, levelOfDetail;
     double animDelay;
     std::string doubleClickedGraphPointCommand;
     double doubleClickedGraphPointX, doubleClickedGraphPointY;
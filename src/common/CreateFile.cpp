@@ -50,6 +50,7 @@ int GetFileFormatFromExtension(const std::string &ext, double *version)
   else if(ext == ".opt")      return FORMAT_OPT;
   else if(ext == ".unv")      return FORMAT_UNV;
   else if(ext == ".vtk")      return FORMAT_VTK;
+  else if(ext == ".vtu")      return FORMAT_VTU;
   else if(ext == ".m")        return FORMAT_MATLAB;
   else if(ext == ".dat")      return FORMAT_TOCHNOG;
   else if(ext == ".txt")      return FORMAT_TXT;
@@ -119,6 +120,7 @@ std::string GetDefaultFileExtension(int format, bool onlyMeshFormats)
   case FORMAT_OPT:     name = ".opt"; break;
   case FORMAT_UNV:     name = ".unv"; mesh = true; break;
   case FORMAT_VTK:     name = ".vtk"; mesh = true; break;
+  case FORMAT_VTU:     name = ".vtu"; mesh = true; break;
   case FORMAT_MATLAB:  name = ".m"; mesh = true; break;
   case FORMAT_TOCHNOG: name = ".dat"; mesh = true; break;
   case FORMAT_STL:     name = ".stl"; mesh = true; break;
@@ -391,6 +393,23 @@ void CreateOutputFile(const std::string &fileName, int format,
        CTX::instance()->bigEndian);
     break;
 
+  case FORMAT_VTU:
+    if(GModel::current()->getNumPartitions() &&
+       CTX::instance()->mesh.partitionSplitMeshFiles){
+      std::vector<std::string> splitName = SplitFileName(name);
+      splitName[0] += splitName[1];
+      GModel::current()->writePartitionedVTU
+        (splitName[0], CTX::instance()->mesh.binary,
+         CTX::instance()->mesh.saveAll, CTX::instance()->mesh.scalingFactor,
+         CTX::instance()->bigEndian);
+    }
+    else{
+      GModel::current()->writeVTU
+        (name, CTX::instance()->mesh.binary, CTX::instance()->mesh.saveAll,
+         CTX::instance()->mesh.scalingFactor, CTX::instance()->bigEndian);
+    }
+    break;
+
   case FORMAT_MATLAB:
     GModel::current()->writeMATLAB
       (name, CTX::instance()->mesh.binary, CTX::instance()->mesh.saveAll,
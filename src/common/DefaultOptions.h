@@ -1054,6 +1054,10 @@ StringXNumber GeometryOptions_Number[] = {
     "Display size of points (in pixels)" },
   { F|O, "PointType" , opt_geometry_point_type , 0. ,
     "Display points as solid color dots (0) or 3D spheres (1)" },
+  { F|O, "ProjectionCacheSize" , opt_geometry_projection_cache_size , 0. ,
+    "Number of subdivisions in each parametric direction of the sampling of "
+    "surfaces used to compute initial guesses when projecting points on them "
+    "(0: disabled)" },
 
   { F|O, "ReparamOnFaceRobust" , opt_geometry_reparam_on_face_robust, 0 ,
     "Use projection for reparametrization of a point classified on GEdge on a GFace" },
@@ -1192,6 +1196,10 @@ StringXNumber MeshOptions_Number[] = {
     "[Deprecated]" },
   { F|O, "CompoundMeshSizeFactor" , opt_mesh_compound_lc_factor , 0.5 ,
     "Mesh size factor applied to compound parts" },
+  { F|O, "CompactConnectivity" , opt_mesh_compact_connectivity , 0. ,
+    "Keep a compact copy of the element connectivity (element and node tags in "
+    "flat arrays per element type and entity), built on demand and used by "
+    "e.g. the MSH4 writer and the API to avoid traversing the element objects" },
   { F,   "CpuTime" , opt_mesh_cpu_time , 0. ,
     "CPU time (in seconds) for the generation of the current mesh (read-only)" },
   { F|O, "CreateTopologyMsh2" , opt_mesh_create_topology_msh2, 0. ,
@@ -1218,7 +1226,8 @@ StringXNumber MeshOptions_Number[] = {
   { F|O, "Format" , opt_mesh_file_format , FORMAT_AUTO ,
     "Mesh output format (1: msh, 2: unv, 10: auto, 16: vtk, 19: vrml, 21: mail, "
     "26: pos stat, 27: stl, 28: p3d, 30: mesh, 31: bdf, 32: cgns, 33: med, 34: diff, "
-    "38: ir3, 39: inp, 40: ply2, 41: celum, 42: su2, 47: tochnog, 49: neu, 50: matlab)" },
+    "38: ir3, 39: inp, 40: ply2, 41: celum, 42: su2, 47: tochnog, 49: neu, 50: matlab, "
+    "57: vtu)" },
   { F|O, "Hexahedra" , opt_mesh_hexahedra , 1. ,
     "Display mesh hexahedra?" },
 
@@ -1286,6 +1295,10 @@ StringXNumber MeshOptions_Number[] = {
     "2: physical entity tag, 3: partition, 4: coordinates)" },
   { F|O, "LcIntegrationPrecision" , opt_mesh_lc_integration_precision, 1.e-9 ,
     "Accuracy of evaluation of the LC field for 1D mesh generation" },
+  { F|O, "LevelOfDetail" , opt_mesh_level_of_detail , 0. ,
+    "Number of cells along the size of the model used to build decimated "
+    "(vertex-clustered) vertex arrays, drawn instead of the full arrays when "
+    "the cells are smaller than 2 pixels on screen (0: no decimation)" },
   { F|O, "Light" , opt_mesh_light , 1. ,
     "Enable lighting for the mesh" },
   { F|O, "LightLines" , opt_mesh_light_lines , 2. ,
@@ -1738,6 +1751,12 @@ StringXNumber PostProcessingOptions_Number[] = {
   { F|O, "HorizontalScales" , opt_post_horizontal_scales , 1. ,
     "Display value scales horizontally" },
 
+  { F|O, "LevelOfDetail" , opt_post_level_of_detail , 0. ,
+    "Number of cells along the size of the model used to build decimated "
+    "(vertex-clustered) vertex arrays for post-processing views, drawn instead "
+    "of the full arrays when the cells are smaller than 2 pixels on screen (0: "
+    "no decimation)" },
+
   { F|O, "Link" , opt_post_link , 0. ,
     "Post-processing view links (0: apply next option changes to selected views, "
     "1: force same options for all selected views)" },
@@ -1639,6 +1639,7 @@ int Msg::GetNumThreads(){ return omp_get_num_threads(); }
 void Msg::SetNumThreads(int num){ omp_set_num_threads(num); }
 int Msg::GetMaxThreads(){ return omp_get_max_threads(); }
 int Msg::GetThreadNum(){ return omp_get_thread_num(); }
+int Msg::GetParallelLevel(){ return omp_get_level(); }
 
 #else
 
@@ -1646,6 +1647,7 @@ int Msg::GetNumThreads(){ return 1; }
 void Msg::SetNumThreads(int num){ }
 int Msg::GetMaxThreads(){ return 1; }
 int Msg::GetThreadNum(){ return 0; }
+int Msg::GetParallelLevel(){ return 0; }
 
 #endif
 
@@ -89,6 +89,7 @@ public:
   static void SetNumThreads(int num);
   static int GetMaxThreads();
   static int GetThreadNum();
+  static int GetParallelLevel();
   static void SetVerbosity(int val);
   static void SetLogFile(const std::string &name);
   static int GetVerbosity();
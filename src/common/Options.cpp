@@ -2918,6 +2918,12 @@ double opt_geometry_reparam_on_face_robust(OPT_ARGS_NUM)
   return CTX::instance()->geom.reparamOnFaceRobust;
 }
 
+double opt_geometry_projection_cache_size(OPT_ARGS_NUM)
+{
+  if(action & GMSH_SET) CTX::instance()->geom.projectionCacheSize = (int)val;
+  return CTX::instance()->geom.projectionCacheSize;
+}
+
 double opt_general_point_size(OPT_ARGS_NUM)
 {
   if(action & GMSH_SET) CTX::instance()->pointSize = val;
@@ -6522,6 +6528,18 @@ double opt_mesh_draw_skin_only(OPT_ARGS_NUM)
   return CTX::instance()->mesh.drawSkinOnly;
 }
 
+double opt_mesh_level_of_detail(OPT_ARGS_NUM)
+{
+  if(action & GMSH_SET) {
+    if(CTX::instance()->mesh.levelOfDetail != (int)val)
+      CTX::instance()->mesh.changed |= (ENT_CURVE | ENT_SURFACE | ENT_VOLUME);
+    CTX::instance()->mesh.levelOfDetail = (int)val;
+    if(CTX::instance()->mesh.levelOfDetail < 0)
+      CTX::instance()->mesh.levelOfDetail = 0;
+  }
+  return CTX::instance()->mesh.levelOfDetail;
+}
+
 double opt_mesh_save_all(OPT_ARGS_NUM)
 {
   if(action & GMSH_SET) CTX::instance()->mesh.saveAll = (int)val;
@@ -6606,6 +6624,12 @@ double opt_mesh_compound_lc_factor(OPT_ARGS_NUM)
   return CTX::instance()->mesh.compoundLcFactor;
 }
 
+double opt_mesh_compact_connectivity(OPT_ARGS_NUM)
+{
+  if(action & GMSH_SET) CTX::instance()->mesh.compactConnectivity = (int)val;
+  return CTX::instance()->mesh.compactConnectivity;
+}
+
 double opt_mesh_random_seed(OPT_ARGS_NUM)
 {
   if(action & GMSH_SET) CTX::instance()->mesh.randomSeed = (unsigned int)val;
@@ -7112,6 +7136,22 @@ double opt_post_double_clicked_view(OPT_ARGS_NUM)
   return CTX::instance()->post.doubleClickedView;
 }
 
+double opt_post_level_of_detail(OPT_ARGS_NUM)
+{
+  if(action & GMSH_SET) {
+#if defined(HAVE_POST)
+    if(CTX::instance()->post.levelOfDetail != (int)val) {
+      for(std::size_t i = 0; i < PView::list.size(); i++)
+        PView::list[i]->setChanged(true);
+    }
+#endif
+    CTX::instance()->post.levelOfDetail = (int)val;
+    if(CTX::instance()->post.levelOfDetail < 0)
+      CTX::instance()->post.levelOfDetail = 0;
+  }
+  return CTX::instance()->post.levelOfDetail;
+}
+
 double opt_view_nb_timestep(OPT_ARGS_NUM)
 {
 #if defined(HAVE_POST)
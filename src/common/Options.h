@@ -405,6 +405,7 @@ double opt_geometry_point_size(OPT_ARGS_NUM);
 double opt_geometry_point_sel_size(OPT_ARGS_NUM);
 double opt_geometry_point_type(OPT_ARGS_NUM);
 double opt_geometry_reparam_on_face_robust(OPT_ARGS_NUM);
+double opt_geometry_projection_cache_size(OPT_ARGS_NUM);
 double opt_geometry_curve_width(OPT_ARGS_NUM);
 double opt_geometry_curve_sel_width(OPT_ARGS_NUM);
 double opt_geometry_curve_type(OPT_ARGS_NUM);
@@ -603,6 +604,7 @@ double opt_mesh_cgns_export_structured(OPT_ARGS_NUM);
 double opt_mesh_dual(OPT_ARGS_NUM);
 double opt_mesh_voronoi(OPT_ARGS_NUM);
 double opt_mesh_draw_skin_only(OPT_ARGS_NUM);
+double opt_mesh_level_of_detail(OPT_ARGS_NUM);
 double opt_mesh_save_all(OPT_ARGS_NUM);
 double opt_mesh_save_element_tag_type(OPT_ARGS_NUM);
 double opt_mesh_save_parametric(OPT_ARGS_NUM);
@@ -614,6 +616,7 @@ double opt_mesh_save_groups_of_nodes(OPT_ARGS_NUM);
 double opt_mesh_color_carousel(OPT_ARGS_NUM);
 double opt_mesh_compound_classify(OPT_ARGS_NUM);
 double opt_mesh_compound_lc_factor(OPT_ARGS_NUM);
+double opt_mesh_compact_connectivity(OPT_ARGS_NUM);
 double opt_mesh_random_seed(OPT_ARGS_NUM);
 double opt_mesh_switch_elem_tags(OPT_ARGS_NUM);
 double opt_mesh_zone_definition(OPT_ARGS_NUM);
@@ -676,6 +679,7 @@ double opt_post_save_interpolation_matrices(OPT_ARGS_NUM);
 double opt_post_double_clicked_graph_point_x(OPT_ARGS_NUM);
 double opt_post_double_clicked_graph_point_y(OPT_ARGS_NUM);
 double opt_post_double_clicked_view(OPT_ARGS_NUM);
+double opt_post_level_of_detail(OPT_ARGS_NUM);
 double opt_view_nb_timestep(OPT_ARGS_NUM);
 double opt_view_nb_non_empty_timestep(OPT_ARGS_NUM);
 double opt_view_timestep(OPT_ARGS_NUM);
@@ -4,14 +4,15 @@
 // Please report all issues on https://gitlab.onelab.info/gmsh/gmsh/issues.
 
 #include <string.h>
+#include <cmath>
 #include <algorithm>
+#include <unordered_map>
 #include "GmshMessage.h"
 #include "VertexArray.h"
 #include "Context.h"
 #include "Numeric.h"
 #include "OS.h"
 
-template<int N> float ElementDataLessThan<N>::tolerance = 0.0F;
 float BarycenterLessThan::tolerance = 0.0F;
 
 VertexArray::VertexArray(int numVerticesPerElement, int numElements)
@@ -104,7 +105,6 @@ void VertexArray::add(double *x, double *y, double *z, SVector3 *n, unsigned cha
 
   if(boundary && npe == 3){
     ElementData<3> e(x, y, z, n, r, g, b, a, ele);
-    ElementDataLessThan<3>::tolerance = (float)(CTX::instance()->lc * 1.e-12);
     auto it = _data3.find(e);
     if(it == _data3.end())
       _data3.insert(e);
@@ -138,6 +138,9 @@ void VertexArray::add(double *x, double *y, double *z, SVector3 *n, unsigned cha
 void VertexArray::finalize()
 {
   if(_data3.size()){
+    _vertices.reserve(_vertices.size() + 9 * _data3.size());
+    _normals.reserve(_normals.size() + 9 * _data3.size());
+    _colors.reserve(_colors.size() + 12 * _data3.size());
     auto it = _data3.begin();
     for(; it != _data3.end(); it++){
       for(int i = 0; i < 3; i++){
@@ -152,6 +155,108 @@ void VertexArray::finalize()
   _barycenters.clear();
 }
 
+class VertexCell {
+public:
+  long long i, j, k;
+  VertexCell(long long ii, long long jj, long long kk) : i(ii), j(jj), k(kk) {}
+  bool operator==(const VertexCell &other) const
+  {
+    return i == other.i && j == other.j && k == other.k;
+  }
+};
+
+class VertexCellHash {
+public:
+  std::size_t operator()(const VertexCell &c) const
+  {
+    std::hash<long long> h;
+    std::size_t seed = h(c.i);
+    seed ^= h(c.j) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= h(c.k) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+VertexArray *VertexArray::decimate(double cellSize, bool boundaryOnly,
+                                   const std::vector<char> *volumeFaces)
+{
+  int npe = getNumVerticesPerElement();
+  if(cellSize <= 0. || (npe != 2 && npe != 3)) return nullptr;
+  int numElements = getNumVertices() / npe;
+  bool normals = (_normals.size() == _vertices.size());
+  bool colors = (_colors.size() == 4 * _vertices.size() / 3);
+
+  // remove the triangles that appear twice
+  std::vector<char> keep(numElements, 1);
+  if(boundaryOnly && npe == 3) {
+    std::unordered_map<ElementData<3>, int, ElementDataHash<3>,
+                       ElementDataEqual<3> > faces;
+    for(int i = 0; i < numElements; i++) {
+      if(volumeFaces && (i >= (int)volumeFaces->size() || !(*volumeFaces)[i]))
+        continue;
+      double x[3], y[3], z[3];
+      for(int j = 0; j < 3; j++) {
+        x[j] = _vertices[9 * i + 3 * j];
+        y[j] = _vertices[9 * i + 3 * j + 1];
+        z[j] = _vertices[9 * i + 3 * j + 2];
+      }
+      ElementData<3> e(x, y, z, nullptr, nullptr, nullptr, nullptr, nullptr,
+                       nullptr);
+      auto it = faces.find(e);
+      if(it == faces.end())
+        faces.emplace(e, i);
+      else {
+        keep[i] = 0;
+        keep[it->second] = 0;
+        faces.erase(it);
+      }
+    }
+  }
+
+  // cluster the vertices: all the vertices in a cell are replaced by the first
+  // one encountered
+  double inv = 1. / cellSize;
+  std::unordered_map<VertexCell, int, VertexCellHash> cells;
+  std::unordered_set<VertexCell, VertexCellHash> elements;
+  std::vector<int> rep;
+  VertexArray *va = new VertexArray(npe, 0);
+  for(int i = 0; i < numElements; i++) {
+    if(!keep[i]) continue;
+    long long c[3] = {-1, -1, -1};
+    for(int j = 0; j < npe; j++) {
+      int v = npe * i + j;
+      VertexCell cell((long long)std::floor(_vertices[3 * v] * inv),
+                      (long long)std::floor(_vertices[3 * v + 1] * inv),
+                      (long long)std::floor(_vertices[3 * v + 2] * inv));
+      auto it = cells.find(cell);
+      if(it == cells.end()) {
+        c[j] = rep.size();
+        cells.emplace(cell, (int)rep.size());
+        rep.push_back(v);
+      }
+      else
+        c[j] = it->second;
+    }
+    if(c[0] == c[1] || (npe == 3 && (c[0] == c[2] || c[1] == c[2]))) continue;
+    long long s[3] = {c[0], c[1], c[2]};
+    std::sort(s, s + npe);
+    if(!elements.insert(VertexCell(s[0], s[1], s[2])).second) continue;
+    for(int j = 0; j < npe; j++) {
+      int v = rep[c[j]];
+      for(int k = 0; k < 3; k++) va->_vertices.push_back(_vertices[3 * v + k]);
+      if(normals)
+        for(int k = 0; k < 3; k++) va->_normals.push_back(_normals[3 * v + k]);
+      if(colors)
+        for(int k = 0; k < 4; k++) va->_colors.push_back(_colors[4 * v + k]);
+    }
+  }
+  if(va->getNumVertices() > getNumVertices() / 2) {
+    delete va;
+    return nullptr;
+  }
+  return va;
+}
+
 class AlphaElement {
  public:
   AlphaElement(float *vp, normal_type *np, unsigned char *cp) : v(vp), n(np), c(cp) {}
@@ -349,4 +454,12 @@ void VertexArray::merge(VertexArray* va)
     _elements.insert(_elements.end(), va->firstElementPointer(),
                      va->lastElementPointer());
   }
+  // boundary elements present in both arrays are internal: remove them
+  for(auto it = va->_data3.begin(); it != va->_data3.end(); it++) {
+    auto it2 = _data3.find(*it);
+    if(it2 == _data3.end())
+      _data3.insert(*it);
+    else
+      _data3.erase(it2);
+  }
 }
@@ -8,6 +8,8 @@
 
 #include <vector>
 #include <set>
+#include <unordered_set>
+#include <functional>
 #include "SVector3.h"
 #include "SBoundingBox3d.h"
 
@@ -78,19 +80,29 @@ public:
   }
 };
 
-template <int N> class ElementDataLessThan {
+// hash and equality of element data based on the barycenter: the sum of the
+// (float) coordinates is computed in double precision, and is thus independent
+// of the ordering of the vertices
+template <int N> class ElementDataHash {
+public:
+  std::size_t operator()(const ElementData<N> &e) const
+  {
+    SPoint3 p = e.barycenter();
+    std::hash<double> h;
+    std::size_t seed = h(p.x());
+    seed ^= h(p.y()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= h(p.z()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+template <int N> class ElementDataEqual {
 public:
-  static float tolerance;
   bool operator()(const ElementData<N> &e1, const ElementData<N> &e2) const
   {
     SPoint3 p1 = e1.barycenter();
     SPoint3 p2 = e2.barycenter();
-    if(p1.x() - p2.x() > tolerance) return true;
-    if(p1.x() - p2.x() < -tolerance) return false;
-    if(p1.y() - p2.y() > tolerance) return true;
-    if(p1.y() - p2.y() < -tolerance) return false;
-    if(p1.z() - p2.z() > tolerance) return true;
-    return false;
+    return p1.x() == p2.x() && p1.y() == p2.y() && p1.z() == p2.z();
   }
 };
 
@@ -155,7 +167,8 @@ private:
   std::vector<normal_type> _normals;
   std::vector<unsigned char> _colors;
   std::vector<MElement *> _elements;
-  std::set<ElementData<3>, ElementDataLessThan<3> > _data3;
+  std::unordered_set<ElementData<3>, ElementDataHash<3>, ElementDataEqual<3> >
+    _data3;
   std::set<Barycenter, BarycenterLessThan> _barycenters;
   // std::tr1::unordered_set<Barycenter, BarycenterHash, BarycenterEqual>
   // _barycenters;
@@ -229,7 +242,18 @@ public:
                           double &max, int &numSteps, double &time,
                           double &xmin, double &ymin, double &zmin,
                           double &xmax, double &ymax, double &zmax);
-  // merge another vertex array into this one
+  // create a decimated copy of the array by clustering the vertices on a
+  // regular grid of size cellSize, removing the elements that collapse or that
+  // become duplicated; if boundaryOnly is set, triangles present twice (e.g.
+  // internal faces of volume meshes) are removed first -- if volumeFaces is
+  // also given, only the triangles i with volumeFaces[i] set are considered
+  // for this removal. Element pointers are not copied. Returns nullptr if the
+  // array cannot be decimated or if the decimation does not at least halve the
+  // number of vertices.
+  VertexArray *decimate(double cellSize, bool boundaryOnly = false,
+                        const std::vector<char> *volumeFaces = nullptr);
+  // merge another vertex array into this one (including the pending boundary
+  // elements, which are not yet finalized)
   void merge(VertexArray *va);
 };
 
@@ -5,6 +5,8 @@
 
 #include <sstream>
 #include <regex>
+#include <algorithm>
+#include <exception>
 
 #include "GmshConfig.h"
 #include "GmshDefines.h"
@@ -785,6 +787,81 @@ GMSH_API int gmsh::model::getNumberOfPartitions()
   return GModel::current()->getNumPartitions();
 }
 
+// Call f(i) for i = 0, ..., n - 1, using `General.NumThreads' threads if n is
+// large enough to be worth it (the CAD evaluation functions are thread-safe).
+// As Msg::Error throws in the API, an exception thrown by f in one of the
+// threads is caught and rethrown once all the calls have been made.
+template <class F> static void _forEachPoint(std::size_t n, F f)
+{
+  int nthreads = 1;
+  if(n >= 128) {
+    nthreads = CTX::instance()->numThreads;
+    if(!nthreads) nthreads = Msg::GetMaxThreads();
+  }
+  std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+  for(int i = 0; i < (int)n; i++) {
+    try {
+      f(i);
+    } catch(...) {
+#pragma omp critical(gmshApiForEachPoint)
+      if(!error) error = std::current_exception();
+    }
+  }
+  if(error) std::rethrow_exception(error);
+}
+
+// Get the number of points corresponding to the parametric coordinates on an
+// entity of dimension dim.
+static bool _getNumberOfPoints(const int dim,
+                               const std::vector<double> &parametricCoord,
+                               std::size_t &numPoints)
+{
+  numPoints = 0;
+  if(dim == 0)
+    numPoints = 1;
+  else if(dim == 1)
+    numPoints = parametricCoord.size();
+  else if(dim == 2) {
+    if(parametricCoord.size() % 2) {
+      Msg::Error("Number of parametric coordinates should be even");
+      return false;
+    }
+    numPoints = parametricCoord.size() / 2;
+  }
+  return true;
+}
+
+static void _getValue(GEntity *entity,
+                      const std::vector<double> &parametricCoord,
+                      double *coord)
+{
+  if(entity->dim() == 0) {
+    GVertex *gv = static_cast<GVertex *>(entity);
+    coord[0] = gv->x();
+    coord[1] = gv->y();
+    coord[2] = gv->z();
+  }
+  else if(entity->dim() == 1) {
+    GEdge *ge = static_cast<GEdge *>(entity);
+    _forEachPoint(parametricCoord.size(), [&](std::size_t i) {
+      GPoint gp = ge->point(parametricCoord[i]);
+      coord[3 * i] = gp.x();
+      coord[3 * i + 1] = gp.y();
+      coord[3 * i + 2] = gp.z();
+    });
+  }
+  else if(entity->dim() == 2) {
+    GFace *gf = static_cast<GFace *>(entity);
+    _forEachPoint(parametricCoord.size() / 2, [&](std::size_t i) {
+      GPoint gp = gf->point(parametricCoord[2 * i], parametricCoord[2 * i + 1]);
+      coord[3 * i] = gp.x();
+      coord[3 * i + 1] = gp.y();
+      coord[3 * i + 2] = gp.z();
+    });
+  }
+}
+
 GMSH_API void gmsh::model::getValue(const int dim, const int tag,
                                     const std::vector<double> &parametricCoord,
                                     std::vector<double> &coord)
@@ -796,34 +873,32 @@ GMSH_API void gmsh::model::getValue(const int dim, const int tag,
     Msg::Error("%s does not exist", _getEntityName(dim, tag).c_str());
     return;
   }
-  if(dim == 0) {
-    coord.push_back(static_cast<GVertex *>(entity)->x());
-    coord.push_back(static_cast<GVertex *>(entity)->y());
-    coord.push_back(static_cast<GVertex *>(entity)->z());
-  }
-  else if(dim == 1) {
-    GEdge *ge = static_cast<GEdge *>(entity);
-    for(std::size_t i = 0; i < parametricCoord.size(); i++) {
-      GPoint gp = ge->point(parametricCoord[i]);
-      coord.push_back(gp.x());
-      coord.push_back(gp.y());
-      coord.push_back(gp.z());
-    }
+  std::size_t numPoints;
+  if(!_getNumberOfPoints(dim, parametricCoord, numPoints)) return;
+  coord.resize(3 * numPoints);
+  _getValue(entity, parametricCoord, coord.data());
+}
+
+GMSH_API void
+gmsh::model::getValueInBuffers(const int dim, const int tag,
+                               const std::vector<double> &parametricCoord,
+                               double *coord, const std::size_t coord_n)
+{
+  if(!_checkInit()) return;
+  GEntity *entity = GModel::current()->getEntityByTag(dim, tag);
+  if(!entity) {
+    Msg::Error("%s does not exist", _getEntityName(dim, tag).c_str());
+    return;
   }
-  else if(dim == 2) {
-    if(parametricCoord.size() % 2) {
-      Msg::Error("Number of parametric coordinates should be even");
-      return;
-    }
-    GFace *gf = static_cast<GFace *>(entity);
-    for(std::size_t i = 0; i < parametricCoord.size(); i += 2) {
-      SPoint2 param(parametricCoord[i], parametricCoord[i + 1]);
-      GPoint gp = gf->point(param);
-      coord.push_back(gp.x());
-      coord.push_back(gp.y());
-      coord.push_back(gp.z());
-    }
+  std::size_t numPoints;
+  if(!_getNumberOfPoints(dim, parametricCoord, numPoints)) return;
+  if(!coord_n) return;
+  if(coord_n < 3 * numPoints) {
+    Msg::Error("Coordinate buffer too small (%lu < %lu)", coord_n,
+               3 * numPoints);
+    return;
   }
+  _getValue(entity, parametricCoord, coord);
 }
 
 GMSH_API void
@@ -840,12 +915,13 @@ gmsh::model::getDerivative(const int dim, const int tag,
   }
   if(dim == 1) {
     GEdge *ge = static_cast<GEdge *>(entity);
-    for(std::size_t i = 0; i < parametricCoord.size(); i++) {
+    deriv.resize(3 * parametricCoord.size());
+    _forEachPoint(parametricCoord.size(), [&](std::size_t i) {
       SVector3 d = ge->firstDer(parametricCoord[i]);
-      deriv.push_back(d.x());
-      deriv.push_back(d.y());
-      deriv.push_back(d.z());
-    }
+      deriv[3 * i] = d.x();
+      deriv[3 * i + 1] = d.y();
+      deriv[3 * i + 2] = d.z();
+    });
   }
   else if(dim == 2) {
     if(parametricCoord.size() % 2) {
@@ -853,16 +929,17 @@ gmsh::model::getDerivative(const int dim, const int tag,
       return;
     }
     GFace *gf = static_cast<GFace *>(entity);
-    for(std::size_t i = 0; i < parametricCoord.size(); i += 2) {
-      SPoint2 param(parametricCoord[i], parametricCoord[i + 1]);
+    deriv.resize(3 * parametricCoord.size());
+    _forEachPoint(parametricCoord.size() / 2, [&](std::size_t i) {
+      SPoint2 param(parametricCoord[2 * i], parametricCoord[2 * i + 1]);
       Pair<SVector3, SVector3> d = gf->firstDer(param);
-      deriv.push_back(d.left().x());
-      deriv.push_back(d.left().y());
-      deriv.push_back(d.left().z());
-      deriv.push_back(d.right().x());
-      deriv.push_back(d.right().y());
-      deriv.push_back(d.right().z());
-    }
+      deriv[6 * i] = d.left().x();
+      deriv[6 * i + 1] = d.left().y();
+      deriv[6 * i + 2] = d.left().z();
+      deriv[6 * i + 3] = d.right().x();
+      deriv[6 * i + 4] = d.right().y();
+      deriv[6 * i + 5] = d.right().z();
+    });
   }
 }
 
@@ -880,12 +957,13 @@ gmsh::model::getSecondDerivative(const int dim, const int tag,
   }
   if(dim == 1) {
     GEdge *ge = static_cast<GEdge *>(entity);
-    for(std::size_t i = 0; i < parametricCoord.size(); i++) {
+    deriv.resize(3 * parametricCoord.size());
+    _forEachPoint(parametricCoord.size(), [&](std::size_t i) {
       SVector3 d = ge->secondDer(parametricCoord[i]);
-      deriv.push_back(d.x());
-      deriv.push_back(d.y());
-      deriv.push_back(d.z());
-    }
+      deriv[3 * i] = d.x();
+      deriv[3 * i + 1] = d.y();
+      deriv[3 * i + 2] = d.z();
+    });
   }
   else if(dim == 2) {
     if(parametricCoord.size() % 2) {
@@ -893,20 +971,21 @@ gmsh::model::getSecondDerivative(const int dim, const int tag,
       return;
     }
     GFace *gf = static_cast<GFace *>(entity);
-    for(std::size_t i = 0; i < parametricCoord.size(); i += 2) {
-      SPoint2 param(parametricCoord[i], parametricCoord[i + 1]);
+    deriv.resize(9 * (parametricCoord.size() / 2));
+    _forEachPoint(parametricCoord.size() / 2, [&](std::size_t i) {
+      SPoint2 param(parametricCoord[2 * i], parametricCoord[2 * i + 1]);
       SVector3 dudu, dvdv, dudv;
       gf->secondDer(param, dudu, dvdv, dudv);
-      deriv.push_back(dudu.x());
-      deriv.push_back(dudu.y());
-      deriv.push_back(dudu.z());
-      deriv.push_back(dvdv.x());
-      deriv.push_back(dvdv.y());
-      deriv.push_back(dvdv.z());
-      deriv.push_back(dudv.x());
-      deriv.push_back(dudv.y());
-      deriv.push_back(dudv.z());
-    }
+      deriv[9 * i] = dudu.x();
+      deriv[9 * i + 1] = dudu.y();
+      deriv[9 * i + 2] = dudu.z();
+      deriv[9 * i + 3] = dvdv.x();
+      deriv[9 * i + 4] = dvdv.y();
+      deriv[9 * i + 5] = dvdv.z();
+      deriv[9 * i + 6] = dudv.x();
+      deriv[9 * i + 7] = dudv.y();
+      deriv[9 * i + 8] = dudv.z();
+    });
   }
 }
 
@@ -924,8 +1003,10 @@ gmsh::model::getCurvature(const int dim, const int tag,
   }
   if(dim == 1) {
     GEdge *ge = static_cast<GEdge *>(entity);
-    for(std::size_t i = 0; i < parametricCoord.size(); i++)
-      curvatures.push_back(ge->curvature(parametricCoord[i]));
+    curvatures.resize(parametricCoord.size());
+    _forEachPoint(parametricCoord.size(), [&](std::size_t i) {
+      curvatures[i] = ge->curvature(parametricCoord[i]);
+    });
   }
   else if(dim == 2) {
     if(parametricCoord.size() % 2) {
@@ -933,10 +1014,11 @@ gmsh::model::getCurvature(const int dim, const int tag,
       return;
     }
     GFace *gf = static_cast<GFace *>(entity);
-    for(std::size_t i = 0; i < parametricCoord.size(); i += 2) {
-      SPoint2 param(parametricCoord[i], parametricCoord[i + 1]);
-      curvatures.push_back(gf->curvatureMax(param));
-    }
+    curvatures.resize(parametricCoord.size() / 2);
+    _forEachPoint(parametricCoord.size() / 2, [&](std::size_t i) {
+      SPoint2 param(parametricCoord[2 * i], parametricCoord[2 * i + 1]);
+      curvatures[i] = gf->curvatureMax(param);
+    });
   }
 }
 
@@ -959,20 +1041,25 @@ GMSH_API void gmsh::model::getPrincipalCurvatures(
     Msg::Error("Number of parametric coordinates should be even");
     return;
   }
-  for(std::size_t i = 0; i < parametricCoord.size(); i += 2) {
-    SPoint2 param(parametricCoord[i], parametricCoord[i + 1]);
+  const std::size_t n = parametricCoord.size() / 2;
+  curvaturesMax.resize(n);
+  curvaturesMin.resize(n);
+  directionsMax.resize(3 * n);
+  directionsMin.resize(3 * n);
+  _forEachPoint(n, [&](std::size_t i) {
+    SPoint2 param(parametricCoord[2 * i], parametricCoord[2 * i + 1]);
     double cmin, cmax;
     SVector3 dmin, dmax;
     gf->curvatures(param, dmax, dmin, cmax, cmin);
-    curvaturesMax.push_back(cmax);
-    curvaturesMin.push_back(cmin);
-    directionsMax.push_back(dmax.x());
-    directionsMax.push_back(dmax.y());
-    directionsMax.push_back(dmax.z());
-    directionsMin.push_back(dmin.x());
-    directionsMin.push_back(dmin.y());
-    directionsMin.push_back(dmin.z());
-  }
+    curvaturesMax[i] = cmax;
+    curvaturesMin[i] = cmin;
+    directionsMax[3 * i] = dmax.x();
+    directionsMax[3 * i + 1] = dmax.y();
+    directionsMax[3 * i + 2] = dmax.z();
+    directionsMin[3 * i] = dmin.x();
+    directionsMin[3 * i + 1] = dmin.y();
+    directionsMin[3 * i + 2] = dmin.z();
+  });
 }
 
 GMSH_API void gmsh::model::getNormal(const int tag,
@@ -990,13 +1077,14 @@ GMSH_API void gmsh::model::getNormal(const int tag,
     Msg::Error("Number of parametric coordinates should be even");
     return;
   }
-  for(std::size_t i = 0; i < parametricCoord.size(); i += 2) {
-    SPoint2 param(parametricCoord[i], parametricCoord[i + 1]);
+  normals.resize(3 * (parametricCoord.size() / 2));
+  _forEachPoint(parametricCoord.size() / 2, [&](std::size_t i) {
+    SPoint2 param(parametricCoord[2 * i], parametricCoord[2 * i + 1]);
     SVector3 n = gf->normal(param);
-    normals.push_back(n.x());
-    normals.push_back(n.y());
-    normals.push_back(n.z());
-  }
+    normals[3 * i] = n.x();
+    normals[3 * i + 1] = n.y();
+    normals[3 * i + 2] = n.z();
+  });
 }
 
 GMSH_API void
@@ -1017,20 +1105,21 @@ gmsh::model::getParametrization(const int dim, const int tag,
   }
   if(dim == 1) {
     GEdge *ge = static_cast<GEdge *>(entity);
-    for(std::size_t i = 0; i < coord.size(); i += 3) {
-      SPoint3 p(coord[i], coord[i + 1], coord[i + 2]);
-      double t = ge->parFromPoint(p);
-      parametricCoord.push_back(t);
-    }
+    parametricCoord.resize(coord.size() / 3);
+    _forEachPoint(coord.size() / 3, [&](std::size_t i) {
+      SPoint3 p(coord[3 * i], coord[3 * i + 1], coord[3 * i + 2]);
+      parametricCoord[i] = ge->parFromPoint(p);
+    });
   }
   else if(dim == 2) {
     GFace *gf = static_cast<GFace *>(entity);
-    for(std::size_t i = 0; i < coord.size(); i += 3) {
-      SPoint3 p(coord[i], coord[i + 1], coord[i + 2]);
+    parametricCoord.resize(2 * (coord.size() / 3));
+    _forEachPoint(coord.size() / 3, [&](std::size_t i) {
+      SPoint3 p(coord[3 * i], coord[3 * i + 1], coord[3 * i + 2]);
       SPoint2 uv = gf->parFromPoint(p, true, true);
-      parametricCoord.push_back(uv.x());
-      parametricCoord.push_back(uv.y());
-    }
+      parametricCoord[2 * i] = uv.x();
+      parametricCoord[2 * i + 1] = uv.y();
+    });
   }
 }
 
@@ -1134,11 +1223,50 @@ GMSH_API void gmsh::model::reparametrizeOnSurface(
   }
   else if(dim == 1) {
     GEdge *ge = static_cast<GEdge *>(entity);
-    for(std::size_t i = 0; i < parametricCoord.size(); i++) {
+    surfaceParametricCoord.resize(2 * parametricCoord.size());
+    _forEachPoint(parametricCoord.size(), [&](std::size_t i) {
       SPoint2 p = ge->reparamOnFace(gf, parametricCoord[i], which);
-      surfaceParametricCoord.push_back(p.x());
-      surfaceParametricCoord.push_back(p.y());
-    }
+      surfaceParametricCoord[2 * i] = p.x();
+      surfaceParametricCoord[2 * i + 1] = p.y();
+    });
+  }
+}
+
+// Compute the closest points and their parametric coordinates on the curve or
+// the surface entity; a null output buffer is not filled.
+static void _getClosestPoint(GEntity *entity, const std::vector<double> &coord,
+                             double *closestCoord, double *parametricCoord)
+{
+  if(entity->dim() == 1) {
+    GEdge *ge = static_cast<GEdge *>(entity);
+    _forEachPoint(coord.size() / 3, [&](std::size_t i) {
+      SPoint3 p(coord[3 * i], coord[3 * i + 1], coord[3 * i + 2]);
+      double t;
+      GPoint pp = ge->closestPoint(p, t);
+      if(closestCoord) {
+        closestCoord[3 * i] = pp.x();
+        closestCoord[3 * i + 1] = pp.y();
+        closestCoord[3 * i + 2] = pp.z();
+      }
+      if(parametricCoord) parametricCoord[i] = t;
+    });
+  }
+  else if(entity->dim() == 2) {
+    GFace *gf = static_cast<GFace *>(entity);
+    _forEachPoint(coord.size() / 3, [&](std::size_t i) {
+      SPoint3 p(coord[3 * i], coord[3 * i + 1], coord[3 * i + 2]);
+      double uv[2] = {0, 0};
+      GPoint pp = gf->closestPoint(p, uv);
+      if(closestCoord) {
+        closestCoord[3 * i] = pp.x();
+        closestCoord[3 * i + 1] = pp.y();
+        closestCoord[3 * i + 2] = pp.z();
+      }
+      if(parametricCoord) {
+        parametricCoord[2 * i] = uv[0];
+        parametricCoord[2 * i + 1] = uv[1];
+      }
+    });
   }
 }
 
@@ -1159,31 +1287,42 @@ GMSH_API void gmsh::model::getClosestPoint(const int dim, const int tag,
     Msg::Error("Number of coordinates should be a multiple of 3");
     return;
   }
-  if(dim == 1) {
-    GEdge *ge = static_cast<GEdge *>(entity);
-    for(std::size_t i = 0; i < coord.size(); i += 3) {
-      SPoint3 p(coord[i], coord[i + 1], coord[i + 2]);
-      double t;
-      GPoint pp = ge->closestPoint(p, t);
-      closestCoord.push_back(pp.x());
-      closestCoord.push_back(pp.y());
-      closestCoord.push_back(pp.z());
-      parametricCoord.push_back(t);
-    }
+  if(dim != 1 && dim != 2) return;
+  closestCoord.resize(coord.size());
+  parametricCoord.resize(dim * (coord.size() / 3));
+  _getClosestPoint(entity, coord, closestCoord.data(), parametricCoord.data());
+}
+
+GMSH_API void gmsh::model::getClosestPointInBuffers(
+  const int dim, const int tag, const std::vector<double> &coord,
+  double *closestCoord, const std::size_t closestCoord_n,
+  double *parametricCoord, const std::size_t parametricCoord_n)
+{
+  if(!_checkInit()) return;
+  GEntity *entity = GModel::current()->getEntityByTag(dim, tag);
+  if(!entity) {
+    Msg::Error("%s does not exist", _getEntityName(dim, tag).c_str());
+    return;
   }
-  else if(dim == 2) {
-    GFace *gf = static_cast<GFace *>(entity);
-    for(std::size_t i = 0; i < coord.size(); i += 3) {
-      SPoint3 p(coord[i], coord[i + 1], coord[i + 2]);
-      double uv[2] = {0, 0};
-      GPoint pp = gf->closestPoint(p, uv);
-      closestCoord.push_back(pp.x());
-      closestCoord.push_back(pp.y());
-      closestCoord.push_back(pp.z());
-      parametricCoord.push_back(uv[0]);
-      parametricCoord.push_back(uv[1]);
-    }
+  if(coord.size() % 3) {
+    Msg::Error("Number of coordinates should be a multiple of 3");
+    return;
+  }
+  if(dim != 1 && dim != 2) return;
+  const std::size_t numPoints = coord.size() / 3;
+  if(closestCoord_n && closestCoord_n < 3 * numPoints) {
+    Msg::Error("Coordinate buffer too small (%lu < %lu)", closestCoord_n,
+               3 * numPoints);
+    return;
+  }
+  if(parametricCoord_n && parametricCoord_n < dim * numPoints) {
+    Msg::Error("Parametric coordinate buffer too small (%lu < %lu)",
+               parametricCoord_n, dim * numPoints);
+    return;
   }
+  if(!closestCoord_n && !parametricCoord_n) return;
+  _getClosestPoint(entity, coord, closestCoord_n ? closestCoord : nullptr,
+                   parametricCoord_n ? parametricCoord : nullptr);
 }
 
 GMSH_API void gmsh::model::setVisibility(const vectorpair &dimTags,
@@ -1545,6 +1684,7 @@ gmsh::model::mesh::affineTransform(const std::vector<double> &affineTransform,
                    _getEntityName(ge->dim(), ge->tag()).c_str());
     }
   }
+  GModel::current()->invalidateMeshDataCaches();
 }
 
 static void _getAdditionalNodesOnBoundary(GEntity *entity,
@@ -1662,6 +1802,78 @@ GMSH_API void gmsh::model::mesh::getNodes(std::vector<std::size_t> &nodeTags,
   }
 }
 
+static bool _getEntitiesForNodes(int dim, int tag,
+                                 std::vector<GEntity *> &entities)
+{
+  if(dim >= 0 && tag >= 0) {
+    GEntity *ge = GModel::current()->getEntityByTag(dim, tag);
+    if(!ge) {
+      Msg::Error("%s does not exist", _getEntityName(dim, tag).c_str());
+      return false;
+    }
+    entities.push_back(ge);
+  }
+  else {
+    GModel::current()->getEntities(entities, dim);
+  }
+  return true;
+}
+
+GMSH_API void gmsh::model::mesh::getNumberOfNodes(std::size_t &numNodes,
+                                                  const int dim, const int tag)
+{
+  if(!_checkInit()) return;
+  numNodes = 0;
+  std::vector<GEntity *> entities;
+  if(!_getEntitiesForNodes(dim, tag, entities)) return;
+  for(auto ge : entities) numNodes += ge->mesh_vertices.size();
+}
+
+GMSH_API void gmsh::model::mesh::getNodesInBuffers(
+  std::size_t *nodeTags, const std::size_t nodeTags_n, double *coord,
+  const std::size_t coord_n, const int dim, const int tag)
+{
+  if(!_checkInit()) return;
+  std::vector<GEntity *> entities;
+  if(!_getEntitiesForNodes(dim, tag, entities)) return;
+  std::vector<std::size_t> offset(entities.size() + 1, 0);
+  for(std::size_t i = 0; i < entities.size(); i++)
+    offset[i + 1] = offset[i] + entities[i]->mesh_vertices.size();
+  const std::size_t numNodes = offset.back();
+  if(nodeTags_n && nodeTags_n < numNodes) {
+    Msg::Error("Node tag buffer too small (%lu < %lu)", nodeTags_n, numNodes);
+    return;
+  }
+  if(coord_n && coord_n < 3 * numNodes) {
+    Msg::Error("Coordinate buffer too small (%lu < %lu)", coord_n,
+               3 * numNodes);
+    return;
+  }
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+  // fill the buffers by blocks of nodes, so that the work is balanced even if
+  // most nodes are classified on a single entity
+  const std::size_t block = 4096;
+  const int numBlocks = (int)((numNodes + block - 1) / block);
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+  for(int b = 0; b < numBlocks; b++) {
+    std::size_t first = b * block;
+    std::size_t last = std::min(numNodes, first + block);
+    std::size_t i =
+      std::upper_bound(offset.begin(), offset.end(), first) - offset.begin() - 1;
+    for(std::size_t o = first; o < last; o++) {
+      while(o >= offset[i + 1]) i++;
+      MVertex *v = entities[i]->mesh_vertices[o - offset[i]];
+      if(nodeTags_n) nodeTags[o] = v->getNum();
+      if(coord_n) {
+        coord[3 * o] = v->x();
+        coord[3 * o + 1] = v->y();
+        coord[3 * o + 2] = v->z();
+      }
+    }
+  }
+}
+
 GMSH_API void gmsh::model::mesh::getNodesByElementType(
   const int elementType, std::vector<std::size_t> &nodeTags,
   std::vector<double> &coord, std::vector<double> &parametricCoord,
@@ -1767,6 +1979,7 @@ gmsh::model::mesh::setNode(const std::size_t nodeTag,
   v->setXYZ(coord[0], coord[1], coord[2]);
   if(parametricCoord.size() >= 1) v->setParameter(0, parametricCoord[0]);
   if(parametricCoord.size() >= 2) v->setParameter(1, parametricCoord[1]);
+  GModel::current()->invalidateMeshDataCaches();
 }
 
 GMSH_API void gmsh::model::mesh::rebuildNodeCache(bool onlyIfNecessary)
@@ -1879,6 +2092,7 @@ GMSH_API void gmsh::model::mesh::relocateNodes(const int dim, const int tag)
   }
   for(std::size_t i = 0; i < entities.size(); i++)
     entities[i]->relocateMeshVertices();
+  GModel::current()->invalidateMeshDataCaches();
 }
 
 static void
@@ -1938,6 +2152,60 @@ _getEntitiesForElementTypes(int dim, int tag,
   }
 }
 
+// Call f(elements, first) for consecutive blocks of the elements of the given
+// family in the entities, with global indices in [begin, end) (first being the
+// index of the first element in the block); the entity containing each
+// element is found through a table of element offsets per entity. If parallel
+// is set (i.e. if the caller does not distribute the work itself through
+// "task" and "numTasks"), the blocks are distributed among General.NumThreads
+// threads: f should then only write data for the elements in the block.
+template <class F>
+static void _forElementBlocksByType(const std::vector<GEntity *> &entities,
+                                    int familyType, std::size_t begin,
+                                    std::size_t end, bool parallel, F f)
+{
+  if(begin >= end) return;
+  std::vector<std::size_t> offset(entities.size() + 1, 0);
+  for(std::size_t i = 0; i < entities.size(); i++)
+    offset[i + 1] =
+      offset[i] + entities[i]->getNumMeshElementsByType(familyType);
+  int nthreads = 1;
+  if(parallel) {
+    nthreads = CTX::instance()->numThreads;
+    if(!nthreads) nthreads = Msg::GetMaxThreads();
+  }
+  const std::size_t block = 1024;
+  const int numBlocks = (int)((end - begin + block - 1) / block);
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+  for(int b = 0; b < numBlocks; b++) {
+    std::size_t first = begin + b * block;
+    std::size_t last = std::min(end, first + block);
+    std::size_t i =
+      std::upper_bound(offset.begin(), offset.end(), first) - offset.begin() - 1;
+    std::vector<MElement *> elements(last - first);
+    for(std::size_t o = first; o < last; o++) {
+      while(o >= offset[i + 1]) i++;
+      elements[o - first] =
+        entities[i]->getMeshElementByType(familyType, o - offset[i]);
+    }
+    f(elements, first);
+  }
+}
+
+// Same as above, calling f(e, o) for each element e with global index o.
+template <class F>
+static void _forElementsByType(const std::vector<GEntity *> &entities,
+                               int familyType, std::size_t begin,
+                               std::size_t end, bool parallel, F f)
+{
+  _forElementBlocksByType(
+    entities, familyType, begin, end, parallel,
+    [&](const std::vector<MElement *> &elements, std::size_t first) {
+      for(std::size_t i = 0; i < elements.size(); i++)
+        f(elements[i], first + i);
+    });
+}
+
 GMSH_API void gmsh::model::mesh::getElements(
   std::vector<int> &elementTypes,
   std::vector<std::vector<std::size_t> > &elementTags,
@@ -2283,25 +2551,101 @@ GMSH_API void gmsh::model::mesh::getElementsByType(
     preallocateElementsByType(elementType, haveElementTags, haveNodeTags,
                               elementTags, nodeTags, tag);
   }
-  const std::size_t begin = (task * numElements) / numTasks;
-  const std::size_t end = ((task + 1) * numElements) / numTasks;
-  size_t o = 0;
-  size_t idx = begin * numNodes;
-  for(std::size_t i = 0; i < entities.size(); i++) {
-    GEntity *ge = entities[i];
-    for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType); j++) {
-      if(o >= begin && o < end) {
-        MElement *e = ge->getMeshElementByType(familyType, j);
-        if(haveElementTags) elementTags[o] = e->getNum();
-        if(haveNodeTags) {
-          for(std::size_t k = 0; k < e->getNumVertices(); k++) {
-            nodeTags[idx++] = e->getVertex(k)->getNum();
+  if(numTasks == 1) {
+    // copy the compact connectivities of the entities, if available
+    std::vector<const GEntity::compactConnectivity *> cc;
+    for(std::size_t i = 0; i < entities.size(); i++) {
+      if(!entities[i]->getNumMeshElementsByType(familyType)) continue;
+      const GEntity::compactConnectivity *c =
+        entities[i]->getCompactConnectivity(familyType);
+      if(!c || c->elementType != elementType) {
+        cc.clear();
+        break;
+      }
+      cc.push_back(c);
+    }
+    if(cc.size()) {
+      int nthreads = CTX::instance()->numThreads;
+      if(!nthreads) nthreads = Msg::GetMaxThreads();
+      const std::size_t n = 1 + numNodes;
+      std::size_t o = 0;
+      for(std::size_t i = 0; i < cc.size(); i++) {
+        const std::vector<std::size_t> &d = cc[i]->data;
+        const int num = (int)(d.size() / n);
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+        for(int k = 0; k < num; k++) {
+          if(haveElementTags) elementTags[o + k] = d[k * n];
+          if(haveNodeTags) {
+            for(int j = 0; j < numNodes; j++)
+              nodeTags[(o + k) * numNodes + j] = d[k * n + 1 + j];
           }
         }
+        o += num;
       }
-      o++;
+      return;
     }
   }
+  const std::size_t begin = (task * numElements) / numTasks;
+  const std::size_t end = ((task + 1) * numElements) / numTasks;
+  _forElementsByType(
+    entities, familyType, begin, end, numTasks == 1,
+    [&](MElement *e, std::size_t o) {
+      if(haveElementTags) elementTags[o] = e->getNum();
+      if(haveNodeTags) {
+        for(std::size_t k = 0; k < e->getNumVertices(); k++)
+          nodeTags[o * numNodes + k] = e->getVertex(k)->getNum();
+      }
+    });
+}
+
+GMSH_API void gmsh::model::mesh::getNumberOfElementsByType(
+  const int elementType, std::size_t &numElements, const int tag)
+{
+  if(!_checkInit()) return;
+  numElements = 0;
+  int dim = ElementType::getDimension(elementType);
+  std::map<int, std::vector<GEntity *> > typeEnt;
+  _getEntitiesForElementTypes(dim, tag, typeEnt);
+  const std::vector<GEntity *> &entities(typeEnt[elementType]);
+  int familyType = ElementType::getParentType(elementType);
+  for(std::size_t i = 0; i < entities.size(); i++)
+    numElements += entities[i]->getNumMeshElementsByType(familyType);
+}
+
+GMSH_API void gmsh::model::mesh::getElementsByTypeInBuffers(
+  const int elementType, std::size_t *elementTags,
+  const std::size_t elementTags_n, std::size_t *nodeTags,
+  const std::size_t nodeTags_n, const int tag)
+{
+  if(!_checkInit()) return;
+  int dim = ElementType::getDimension(elementType);
+  std::map<int, std::vector<GEntity *> > typeEnt;
+  _getEntitiesForElementTypes(dim, tag, typeEnt);
+  const std::vector<GEntity *> &entities(typeEnt[elementType]);
+  int familyType = ElementType::getParentType(elementType);
+  std::size_t numElements = 0;
+  for(std::size_t i = 0; i < entities.size(); i++)
+    numElements += entities[i]->getNumMeshElementsByType(familyType);
+  const int numNodes = ElementType::getNumVertices(elementType);
+  if(elementTags_n && elementTags_n < numElements) {
+    Msg::Error("Element tag buffer too small (%lu < %lu)", elementTags_n,
+               numElements);
+    return;
+  }
+  if(nodeTags_n && nodeTags_n < numElements * numNodes) {
+    Msg::Error("Node tag buffer too small (%lu < %lu)", nodeTags_n,
+               numElements * numNodes);
+    return;
+  }
+  _forElementsByType(
+    entities, familyType, 0, numElements, true,
+    [&](MElement *e, std::size_t o) {
+      if(elementTags_n) elementTags[o] = e->getNum();
+      if(nodeTags_n) {
+        for(std::size_t k = 0; k < e->getNumVertices(); k++)
+          nodeTags[o * numNodes + k] = e->getVertex(k)->getNum();
+      }
+    });
 }
 
 GMSH_API void gmsh::model::mesh::preallocateElementsByType(
@@ -2354,69 +2698,73 @@ GMSH_API void gmsh::model::mesh::getElementQualities(
     elementQualities.resize(numElements, 0.);
   }
 
+  const int measure = MElement::getQualityMeasureIndex(qualityName);
+  if(measure < 0) {
+    Msg::Error("Unknown quality name '%s'", qualityName.c_str());
+    return;
+  }
+
   const std::size_t begin = (task * numElements) / numTasks;
   const std::size_t end = ((task + 1) * numElements) / numTasks;
-  for(size_t k = begin; k < end; k++){
+  // look up the elements first, then compute the measures in parallel (if
+  // they can be evaluated concurrently and if the caller does not split the
+  // work itself)
+  std::vector<MElement *> elements(end - begin, nullptr);
+  for(std::size_t k = begin; k < end; k++) {
     MElement *e = GModel::current()->getMeshElementByTag(elementTags[k]);
-    if(!e) {
-      Msg::Error("Unknown element %d", elementTags[k]);
-      elementQualities[k] = 0.;
-      continue;
-    }
-    if(qualityName == "minSICN"){
-      elementQualities[k] = e->minSICNShapeMeasure();
-    }
-    else if(qualityName == "minSIGE"){
-      elementQualities[k] = e->minSIGEShapeMeasure();
-    }
-    else if(qualityName == "minSJ"){
-      elementQualities[k] = e->distoShapeMeasure();
-    }
-    else if(qualityName == "gamma"){
-      elementQualities[k] = e->gammaShapeMeasure();
-    }
-    else if(qualityName == "eta"){
-      elementQualities[k] = e->etaShapeMeasure();
-    }
-    else if(qualityName == "minIsotropy"){
-      elementQualities[k] = e->minIsotropyMeasure();
-    }
-    else if(qualityName == "angleShape"){
-      elementQualities[k] = e->angleShapeMeasure();
-    }
-    else if(qualityName == "volume"){
-      elementQualities[k] = e->getVolume();
-    }
-    else if(qualityName == "minEdge"){
-      elementQualities[k] = e->minEdge();
-    }
-    else if(qualityName == "maxEdge"){
-      elementQualities[k] = e->maxEdge();
-    }
-    else if(qualityName == "outerRadius"){
-      elementQualities[k] = e->getOuterRadius();
-    }
-    else if(qualityName == "innerRadius"){
-      elementQualities[k] = e->getInnerRadius();
-    }
-#if defined(HAVE_MESH)
-    else if(qualityName == "minDetJac"){
-      double min, max;
-      jacobianBasedQuality::minMaxJacobianDeterminant(e, min, max);
-      elementQualities[k] = min;
-    }
-    else if(qualityName == "maxDetJac"){
-      double min, max;
-      jacobianBasedQuality::minMaxJacobianDeterminant(e, min, max);
-      elementQualities[k] = max;
-    }
-#endif
-    else{
-      if(k == begin) {
-        Msg::Error("Unknown quality name '%s'", qualityName.c_str());
-      }
-      elementQualities[k] = 0.;
+    if(!e) Msg::Error("Unknown element %d", elementTags[k]);
+    elements[k - begin] = e;
+  }
+  int nthreads = 1;
+  if(numTasks == 1 && MElement::isQualityMeasureThreadSafe(measure)) {
+    nthreads = CTX::instance()->numThreads;
+    if(!nthreads) nthreads = Msg::GetMaxThreads();
+  }
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+  for(int k = 0; k < (int)elements.size(); k++) {
+    MElement *e = elements[k];
+    elementQualities[begin + k] = e ? e->getQualityMeasure(measure) : 0.;
+  }
+}
+
+GMSH_API void gmsh::model::mesh::getElementQualitiesByType(
+  const int elementType, std::vector<std::size_t> &elementTags,
+  std::vector<double> &elementQualities, const std::string &qualityName,
+  const int tag)
+{
+  if(!_checkInit()) return;
+  elementTags.clear();
+  elementQualities.clear();
+  const int measure = MElement::getQualityMeasureIndex(qualityName);
+  if(measure < 0) {
+    Msg::Error("Unknown quality name '%s'", qualityName.c_str());
+    return;
+  }
+  int dim = ElementType::getDimension(elementType);
+  std::map<int, std::vector<GEntity *> > typeEnt;
+  _getEntitiesForElementTypes(dim, tag, typeEnt);
+  const std::vector<GEntity *> &entities(typeEnt[elementType]);
+  int familyType = ElementType::getParentType(elementType);
+  std::size_t numElements = 0;
+  for(std::size_t i = 0; i < entities.size(); i++)
+    numElements += entities[i]->getNumMeshElementsByType(familyType);
+  elementTags.resize(numElements);
+  elementQualities.resize(numElements);
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+  std::size_t o = 0;
+  for(std::size_t i = 0; i < entities.size(); i++) {
+    GEntity *ge = entities[i];
+    // computed in parallel and cached on the entity
+    const std::vector<double> &q =
+      ge->getMeshElementQualities(familyType, measure);
+    const int num = (int)q.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for(int k = 0; k < num; k++) {
+      elementTags[o + k] = ge->getMeshElementByType(familyType, k)->getNum();
+      elementQualities[o + k] = q[k];
     }
+    o += num;
   }
 }
 
@@ -2525,195 +2873,71 @@ GMSH_API void gmsh::model::mesh::getJacobians(
                          coord, tag);
   }
   // get data
-  {
-    const size_t begin = (task * numElements) / numTasks;
-    const size_t end = ((task + 1) * numElements) / numTasks;
-    if(haveDeterminants && haveJacobians && havePoints) {
-      std::vector<std::vector<SVector3> > gsf;
-      size_t o = 0;
-      size_t idx = begin * numPoints;
-      for(std::size_t i = 0; i < entities.size(); i++) {
-        GEntity *ge = entities[i];
-        for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType);
-            j++) {
-          if(o >= begin && o < end) {
-            MElement *e = ge->getMeshElementByType(familyType, j);
-            if(gsf.size() == 0) {
-              gsf.resize(numPoints);
-              for(int k = 0; k < numPoints; k++) {
-                double value[1256][3];
-                e->getGradShapeFunctions(localCoord[3 * k],
-                                         localCoord[3 * k + 1],
-                                         localCoord[3 * k + 2], value);
-                gsf[k].resize(e->getNumShapeFunctions());
-                for(std::size_t l = 0; l < e->getNumShapeFunctions(); l++) {
-                  gsf[k][l][0] = value[l][0];
-                  gsf[k][l][1] = value[l][1];
-                  gsf[k][l][2] = value[l][2];
-                }
-              }
-            }
-            for(int k = 0; k < numPoints; k++) {
-              e->pnt(localCoord[3 * k], localCoord[3 * k + 1],
-                     localCoord[3 * k + 2], &coord[idx * 3]);
-              determinants[idx] = e->getJacobian(gsf[k], &jacobians[idx * 9]);
-              idx++;
-            }
-          }
-          o++;
+  const size_t begin = (task * numElements) / numTasks;
+  const size_t end = ((task + 1) * numElements) / numTasks;
+  if(begin >= end) return;
+  // the gradients of the shape functions at the evaluation points are the same
+  // for all the elements; computing them (serially) on the first element also
+  // makes sure that the basis is created before the parallel loop
+  std::vector<std::vector<SVector3> > gsf(numPoints);
+  fullMatrix<double> gsfMat;
+  for(std::size_t i = 0; i < entities.size(); i++) {
+    if(!entities[i]->getNumMeshElementsByType(familyType)) continue;
+    MElement *e = entities[i]->getMeshElementByType(familyType, 0);
+    const int numShapeFunctions = e->getNumShapeFunctions();
+    gsfMat.resize(3 * numPoints, numShapeFunctions);
+    for(int k = 0; k < numPoints; k++) {
+      double value[1256][3];
+      e->getGradShapeFunctions(localCoord[3 * k], localCoord[3 * k + 1],
+                               localCoord[3 * k + 2], value);
+      gsf[k].resize(numShapeFunctions);
+      for(int l = 0; l < numShapeFunctions; l++) {
+        for(int m = 0; m < 3; m++) {
+          gsf[k][l][m] = value[l][m];
+          gsfMat(3 * k + m, l) = value[l][m];
         }
       }
     }
-    else if(haveDeterminants && haveJacobians && !havePoints) {
-      std::vector<std::vector<SVector3> > gsf;
-      size_t o = 0;
-      size_t idx = begin * numPoints;
-      for(std::size_t i = 0; i < entities.size(); i++) {
-        GEntity *ge = entities[i];
-        for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType);
-            j++) {
-          if(o >= begin && o < end) {
-            MElement *e = ge->getMeshElementByType(familyType, j);
-            if(gsf.size() == 0) {
-              gsf.resize(numPoints);
-              for(int k = 0; k < numPoints; k++) {
-                double value[1256][3];
-                e->getGradShapeFunctions(localCoord[3 * k],
-                                         localCoord[3 * k + 1],
-                                         localCoord[3 * k + 2], value);
-                gsf[k].resize(e->getNumShapeFunctions());
-                for(std::size_t l = 0; l < e->getNumShapeFunctions(); l++) {
-                  gsf[k][l][0] = value[l][0];
-                  gsf[k][l][1] = value[l][1];
-                  gsf[k][l][2] = value[l][2];
-                }
-              }
-            }
-            for(int k = 0; k < numPoints; k++) {
-              determinants[idx] = e->getJacobian(gsf[k], &jacobians[idx * 9]);
-              idx++;
-            }
-          }
-          o++;
-        }
-      }
+    if(havePoints) {
+      double xyz[3];
+      e->pnt(localCoord[0], localCoord[1], localCoord[2], xyz);
     }
-    else if(haveDeterminants && !haveJacobians && havePoints) {
-      std::vector<double> jac(9, 0.);
-      std::vector<std::vector<SVector3> > gsf;
-      size_t o = 0;
-      size_t idx = begin * numPoints;
-      for(std::size_t i = 0; i < entities.size(); i++) {
-        GEntity *ge = entities[i];
-        for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType);
-            j++) {
-          if(o >= begin && o < end) {
-            MElement *e = ge->getMeshElementByType(familyType, j);
-            if(gsf.size() == 0) {
-              gsf.resize(numPoints);
-              for(int k = 0; k < numPoints; k++) {
-                double value[1256][3];
-                e->getGradShapeFunctions(localCoord[3 * k],
-                                         localCoord[3 * k + 1],
-                                         localCoord[3 * k + 2], value);
-                gsf[k].resize(e->getNumShapeFunctions());
-                for(std::size_t l = 0; l < e->getNumShapeFunctions(); l++) {
-                  gsf[k][l][0] = value[l][0];
-                  gsf[k][l][1] = value[l][1];
-                  gsf[k][l][2] = value[l][2];
-                }
-              }
-            }
-            for(int k = 0; k < numPoints; k++) {
-              e->pnt(localCoord[3 * k], localCoord[3 * k + 1],
-                     localCoord[3 * k + 2], &coord[idx * 3]);
-              determinants[idx] = e->getJacobian(gsf[k], &jac[0]);
-              idx++;
-            }
+    break;
+  }
+  // sub-elements redefine the Jacobian computation, and are thus handled one
+  // element at a time; all the other elements are handled by blocks, the
+  // Jacobians of a block being computed with a single matrix product
+  const bool subElements =
+    (elementType == MSH_PNT_SUB || elementType == MSH_LIN_SUB ||
+     elementType == MSH_TRI_SUB || elementType == MSH_TET_SUB);
+  _forElementBlocksByType(
+    entities, familyType, begin, end, numTasks == 1,
+    [&](const std::vector<MElement *> &elements, std::size_t first) {
+      if(havePoints) {
+        for(std::size_t i = 0; i < elements.size(); i++) {
+          for(int k = 0; k < numPoints; k++) {
+            std::size_t idx = (first + i) * numPoints + k;
+            elements[i]->pnt(localCoord[3 * k], localCoord[3 * k + 1],
+                             localCoord[3 * k + 2], &coord[idx * 3]);
           }
-          o++;
         }
       }
-    }
-    else if(haveDeterminants && !haveJacobians && !havePoints) {
-      std::vector<double> jac(9, 0.);
-      std::vector<std::vector<SVector3> > gsf;
-      size_t o = 0;
-      size_t idx = begin * numPoints;
-      for(std::size_t i = 0; i < entities.size(); i++) {
-        GEntity *ge = entities[i];
-        for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType);
-            j++) {
-          if(o >= begin && o < end) {
-            MElement *e = ge->getMeshElementByType(familyType, j);
-            if(gsf.size() == 0) {
-              gsf.resize(numPoints);
-              for(int k = 0; k < numPoints; k++) {
-                double value[1256][3];
-                e->getGradShapeFunctions(localCoord[3 * k],
-                                         localCoord[3 * k + 1],
-                                         localCoord[3 * k + 2], value);
-                gsf[k].resize(e->getNumShapeFunctions());
-                for(std::size_t l = 0; l < e->getNumShapeFunctions(); l++) {
-                  gsf[k][l][0] = value[l][0];
-                  gsf[k][l][1] = value[l][1];
-                  gsf[k][l][2] = value[l][2];
-                }
-              }
-            }
-            for(int k = 0; k < numPoints; k++) {
-              determinants[idx] = e->getJacobian(gsf[k], &jac[0]);
-              idx++;
-            }
-          }
-          o++;
-        }
+      double *jac = haveJacobians ? &jacobians[9 * first * numPoints] : nullptr;
+      double *det =
+        haveDeterminants ? &determinants[first * numPoints] : nullptr;
+      if(!subElements) {
+        MElement::getJacobians(elements, gsfMat, jac, det);
+        return;
       }
-    }
-    else if(!haveDeterminants && haveJacobians && !havePoints) {
-      std::vector<std::vector<SVector3> > gsf;
-      size_t o = 0;
-      size_t idx = begin * numPoints;
-      for(std::size_t i = 0; i < entities.size(); i++) {
-        GEntity *ge = entities[i];
-        for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType);
-            j++) {
-          if(o >= begin && o < end) {
-            MElement *e = ge->getMeshElementByType(familyType, j);
-            if(gsf.size() == 0) {
-              gsf.resize(numPoints);
-              for(int k = 0; k < numPoints; k++) {
-                double value[1256][3];
-                e->getGradShapeFunctions(localCoord[3 * k],
-                                         localCoord[3 * k + 1],
-                                         localCoord[3 * k + 2], value);
-                gsf[k].resize(e->getNumShapeFunctions());
-                for(std::size_t l = 0; l < e->getNumShapeFunctions(); l++) {
-                  gsf[k][l][0] = value[l][0];
-                  gsf[k][l][1] = value[l][1];
-                  gsf[k][l][2] = value[l][2];
-                }
-              }
-            }
-            for(int k = 0; k < numPoints; k++) {
-              e->getJacobian(gsf[k], &jacobians[idx * 9]);
-              idx++;
-            }
-          }
-          o++;
+      double tmp[9];
+      for(std::size_t i = 0; i < elements.size(); i++) {
+        for(int k = 0; k < numPoints; k++) {
+          std::size_t idx = i * numPoints + k;
+          double d = elements[i]->getJacobian(gsf[k], jac ? &jac[9 * idx] : tmp);
+          if(det) det[idx] = d;
         }
       }
-    }
-    else {
-      Msg::Error("The case with 'haveDeterminants = %s', `haveJacobians = %s` "
-                 "and 'havePoints = %s' is not yet implemented",
-                 (haveDeterminants ? "true" : "false"),
-                 (haveJacobians ? "true" : "false"),
-                 (havePoints ? "true" : "false"));
-      return;
-    }
-    // Add other combinaisons if necessary
-  }
+    });
 }
 
 GMSH_API void gmsh::model::mesh::preallocateJacobians(
@@ -3365,9 +3589,9 @@ GMSH_API void gmsh::model::mesh::getBasisFunctionsOrientation(
       elementType, basisFunctionsOrientation, tag);
   }
 
+  const std::size_t begin = task * numElements / numTasks;
+  const std::size_t end = (task + 1) * numElements / numTasks;
   if(fsName == "Lagrange" || fsName == "GradLagrange") { // Lagrange type
-    const std::size_t begin = task * numElements / numTasks;
-    const std::size_t end = (task + 1) * numElements / numTasks;
     for(std::size_t iElement = begin; iElement < end; ++iElement) {
       basisFunctionsOrientation[iElement] = 0;
     }
@@ -3375,21 +3599,13 @@ GMSH_API void gmsh::model::mesh::getBasisFunctionsOrientation(
   else { // Hierarchical type
     const unsigned int numVertices =
       ElementType::getNumVertices(ElementType::getType(familyType, 1, false));
-    std::vector<MVertex *> vertices(numVertices);
-    std::vector<unsigned int> verticesOrder(numVertices);
     const std::size_t factorial[8] = {1, 1, 2, 6, 24, 120, 720, 5040};
 
-    std::size_t entityOffset = 0;
-
-    for(std::size_t iEntity = 0; iEntity < entities.size(); ++iEntity) {
-      const GEntity *ge = entities[iEntity];
-      std::size_t localNumElements = ge->getNumMeshElementsByType(familyType);
-
-      const std::size_t begin = task * localNumElements / numTasks;
-      const std::size_t end = (task + 1) * localNumElements / numTasks;
-
-      for(std::size_t iElement = begin; iElement < end; ++iElement) {
-        MElement *e = ge->getMeshElementByType(familyType, iElement);
+    _forElementsByType(
+      entities, familyType, begin, end, numTasks == 1,
+      [&](MElement *e, std::size_t iElement) {
+        MVertex *vertices[8];
+        unsigned int verticesOrder[8];
         for(std::size_t i = 0; i < numVertices; ++i) {
           vertices[i] = e->getVertex(i);
         }
@@ -3418,12 +3634,8 @@ GMSH_API void gmsh::model::mesh::getBasisFunctionsOrientation(
           }
         }
 
-        basisFunctionsOrientation[entityOffset + iElement] =
-          (int)elementOrientation;
-      }
-
-      entityOffset += localNumElements;
-    }
+        basisFunctionsOrientation[iElement] = (int)elementOrientation;
+      });
   }
 
   return;
@@ -4484,40 +4696,14 @@ GMSH_API void gmsh::model::mesh::getBarycenters(
 
   const size_t begin = (task * numElements) / numTasks;
   const size_t end = ((task + 1) * numElements) / numTasks;
-  size_t o = 0;
-  size_t idx = 3 * begin;
-  if(fast) {
-    for(std::size_t i = 0; i < entities.size(); i++) {
-      GEntity *ge = entities[i];
-      for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType);
-          j++) {
-        if(o >= begin && o < end) {
-          MElement *e = ge->getMeshElementByType(familyType, j);
-          SPoint3 p = e->fastBarycenter(primary);
-          barycenters[idx++] = p[0];
-          barycenters[idx++] = p[1];
-          barycenters[idx++] = p[2];
-        }
-        o++;
-      }
-    }
-  }
-  else {
-    for(std::size_t i = 0; i < entities.size(); i++) {
-      GEntity *ge = entities[i];
-      for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType);
-          j++) {
-        if(o >= begin && o < end) {
-          MElement *e = ge->getMeshElementByType(familyType, j);
-          SPoint3 p = e->barycenter(primary);
-          barycenters[idx++] = p[0];
-          barycenters[idx++] = p[1];
-          barycenters[idx++] = p[2];
-        }
-        o++;
-      }
-    }
-  }
+  _forElementsByType(
+    entities, familyType, begin, end, numTasks == 1,
+    [&](MElement *e, std::size_t o) {
+      SPoint3 p = fast ? e->fastBarycenter(primary) : e->barycenter(primary);
+      barycenters[3 * o] = p[0];
+      barycenters[3 * o + 1] = p[1];
+      barycenters[3 * o + 2] = p[2];
+    });
 }
 
 static bool _getIntegrationInfo(const std::string &intType,
@@ -4627,27 +4813,19 @@ GMSH_API void gmsh::model::mesh::getElementEdgeNodes(
   }
   const size_t begin = (task * numElements) / numTasks;
   const size_t end = ((task + 1) * numElements) / numTasks;
-  size_t o = 0;
-  size_t idx = numEdgesPerEle * numNodesPerEdge * begin;
-  for(std::size_t i = 0; i < entities.size(); i++) {
-    GEntity *ge = entities[i];
-    for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType); j++) {
-      if(o >= begin && o < end) {
-        MElement *e = ge->getMeshElementByType(familyType, j);
-        for(int k = 0; k < numEdgesPerEle; k++) {
-          std::vector<MVertex *> v;
-          // we could use e->getHighOrderEdge() here if we decide to remove
-          // getEdgeVertices
-          e->getEdgeVertices(k, v);
-          std::size_t N = primary ? 2 : v.size();
-          for(std::size_t l = 0; l < N; l++) {
-            nodeTags[idx++] = v[l]->getNum();
-          }
-        }
+  _forElementsByType(
+    entities, familyType, begin, end, numTasks == 1,
+    [&](MElement *e, std::size_t o) {
+      std::size_t idx = numEdgesPerEle * numNodesPerEdge * o;
+      for(int k = 0; k < numEdgesPerEle; k++) {
+        std::vector<MVertex *> v;
+        // we could use e->getHighOrderEdge() here if we decide to remove
+        // getEdgeVertices
+        e->getEdgeVertices(k, v);
+        std::size_t N = primary ? 2 : v.size();
+        for(std::size_t l = 0; l < N; l++) { nodeTags[idx++] = v[l]->getNum(); }
       }
-      o++;
-    }
-  }
+    });
 }
 
 GMSH_API void gmsh::model::mesh::getElementFaceNodes(
@@ -4702,30 +4880,22 @@ GMSH_API void gmsh::model::mesh::getElementFaceNodes(
   }
   const size_t begin = (task * numElements) / numTasks;
   const size_t end = ((task + 1) * numElements) / numTasks;
-  size_t o = 0;
-  size_t idx = numFacesPerEle * numNodesPerFace * begin;
-  for(std::size_t i = 0; i < entities.size(); i++) {
-    GEntity *ge = entities[i];
-    for(std::size_t j = 0; j < ge->getNumMeshElementsByType(familyType); j++) {
-      if(o >= begin && o < end) {
-        MElement *e = ge->getMeshElementByType(familyType, j);
-        int nf = e->getNumFaces();
-        for(int k = 0; k < nf; k++) {
-          MFace f = e->getFace(k);
-          if(faceType != (int)f.getNumVertices()) continue;
-          std::vector<MVertex *> v;
-          // we could use e->getHighOrderFace() here if we decide to remove
-          // getFaceVertices
-          e->getFaceVertices(k, v);
-          std::size_t N = primary ? faceType : v.size();
-          for(std::size_t l = 0; l < N; l++) {
-            nodeTags[idx++] = v[l]->getNum();
-          }
-        }
+  _forElementsByType(
+    entities, familyType, begin, end, numTasks == 1,
+    [&](MElement *e, std::size_t o) {
+      std::size_t idx = numFacesPerEle * numNodesPerFace * o;
+      int nf = e->getNumFaces();
+      for(int k = 0; k < nf; k++) {
+        MFace f = e->getFace(k);
+        if(faceType != (int)f.getNumVertices()) continue;
+        std::vector<MVertex *> v;
+        // we could use e->getHighOrderFace() here if we decide to remove
+        // getFaceVertices
+        e->getFaceVertices(k, v);
+        std::size_t N = primary ? faceType : v.size();
+        for(std::size_t l = 0; l < N; l++) { nodeTags[idx++] = v[l]->getNum(); }
       }
-      o++;
-    }
-  }
+    });
 }
 
 GMSH_API void
@@ -5257,6 +5427,9 @@ gmsh::model::mesh::reorderElements(const int elementType, const int tag,
     Msg::Error("No elements to reorder");
     return;
   }
+  // elements are reordered in place: invalidate the data cached on the
+  // entities (compact connectivity, element qualities)
+  GModel::current()->invalidateMeshDataCaches();
   for(std::size_t i = 0; i < entities.size(); i++) {
     if(!entities[i]->reorder(elementType, ordering)) {
       Msg::Error("Could not reorder elements");
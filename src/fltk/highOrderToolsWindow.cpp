@@ -232,6 +232,9 @@ static void highordertools_runopti_cb(Fl_Widget *w, void *data)
 
   FixPeriodicMesh(GModel::current());
 
+  // nodes have been moved: invalidate the cached data computed from the mesh
+  GModel::current()->invalidateMeshDataCaches();
+
   CTX::instance()->mesh.changed |= (ENT_CURVE | ENT_SURFACE | ENT_VOLUME);
   drawContext::global()->draw();
 }
@@ -15,6 +15,7 @@
 #include "PView.h"
 #include "Context.h"
 #include "OS.h"
+#include "VertexArray.h"
 
 #if defined(HAVE_MESH)
 #include "Generator.h"
@@ -228,6 +229,27 @@ statisticsWindow::statisticsWindow(int deltaFontSize)
   FL_NORMAL_SIZE += deltaFontSize;
 }
 
+static void getVertexArraysMemory(double &full, double &lod)
+{
+  full = lod = 0.;
+  std::vector<GEntity *> entities;
+  GModel::current()->getEntities(entities);
+  for(std::size_t i = 0; i < entities.size(); i++) {
+    GEntity *e = entities[i];
+    if(e->va_lines) full += e->va_lines->getMemoryInMb();
+    if(e->va_triangles) full += e->va_triangles->getMemoryInMb();
+    if(e->va_lines_lod) lod += e->va_lines_lod->getMemoryInMb();
+    if(e->va_triangles_lod) lod += e->va_triangles_lod->getMemoryInMb();
+  }
+  for(std::size_t i = 0; i < PView::list.size(); i++) {
+    PView *p = PView::list[i];
+    if(p->va_lines) full += p->va_lines->getMemoryInMb();
+    if(p->va_triangles) full += p->va_triangles->getMemoryInMb();
+    if(p->va_lines_lod) lod += p->va_lines_lod->getMemoryInMb();
+    if(p->va_triangles_lod) lod += p->va_triangles_lod->getMemoryInMb();
+  }
+}
+
 void statisticsWindow::compute(bool elementQuality)
 {
   int num = 0;
@@ -374,7 +396,14 @@ void statisticsWindow::compute(bool elementQuality)
   static char mem[256];
   std::size_t m = GetMemoryUsage();
   if(m) {
-    sprintf(mem, "Memory usage: %gMb", m / 1024. / 1024.);
+    double full, lod;
+    getVertexArraysMemory(full, lod);
+    if(lod)
+      sprintf(mem, "Memory usage: %gMb (display: %gMb + %gMb decimated)",
+              m / 1024. / 1024., full, lod);
+    else
+      sprintf(mem, "Memory usage: %gMb (display: %gMb)", m / 1024. / 1024.,
+              full);
     memUsage->label(mem);
   }
 }
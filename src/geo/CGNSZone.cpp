@@ -156,8 +156,11 @@ int CGNSZone::readVertices(int dim, double scale,
     return 0;
   }
 
-  // read vertex coordinates
-  std::vector<double> xyz[3];
+  // create vertices, then read coordinates one component at a time into a
+  // single buffer, to avoid holding all the raw coordinates of the zone
+  zoneVert.reserve(nbNode());
+  for(int i = 0; i < nbNode(); i++) zoneVert.push_back(new MVertex(0., 0., 0.));
+  std::vector<double> coord(nbNode());
   for(int iXYZ = 0; iXYZ < dim; iXYZ++) {
     char xyzName[CGNS_MAX_STR_LEN];
     CGNS_ENUMT(DataType_t) dataType;
@@ -165,20 +168,19 @@ int CGNSZone::readVertices(int dim, double scale,
                             &dataType, xyzName);
     if(cgnsErr != CG_OK) return cgnsError(__FILE__, __LINE__, fileIndex());
     const cgsize_t startInd[3] = {1, 1, 1};
-    xyz[iXYZ].resize(nbNode());
     cgnsErr =
       cg_coord_read(fileIndex(), baseIndex(), index(), xyzName,
-                    CGNS_ENUMV(RealDouble), startInd, size(), xyz[iXYZ].data());
+                    CGNS_ENUMV(RealDouble), startInd, size(), coord.data());
     if(cgnsErr != CG_OK) return cgnsError(__FILE__, __LINE__, fileIndex());
-  }
-
-  // create vertices
-  zoneVert.reserve(nbNode());
-  for(int i = 0; i < nbNode(); i++) {
-    const double x = xyz[0][i] * scale;
-    const double y = (dim > 1) ? xyz[1][i] * scale : 0.;
-    const double z = (dim > 2) ? xyz[2][i] * scale : 0.;
-    zoneVert.push_back(new MVertex(x, y, z));
+    for(int i = 0; i < nbNode(); i++) {
+      MVertex *v = zoneVert[i];
+      if(iXYZ == 0)
+        v->x() = coord[i] * scale;
+      else if(iXYZ == 1)
+        v->y() = coord[i] * scale;
+      else
+        v->z() = coord[i] * scale;
+    }
   }
 
   return 1;
@@ -6,6 +6,8 @@
 // Contributor(s):
 //   Thomas Toulorge
 
+#include <algorithm>
+
 #include "GmshMessage.h"
 #include "MVertex.h"
 #include "MElement.h"
@@ -17,6 +19,9 @@
 
 namespace {
 
+  // number of elements of a section read from the file at once
+  const cgsize_t cgnsElementChunkSize = 65536;
+
   MElement *createElement(CGNS_ENUMT(ElementType_t) sectEltType,
                           std::size_t vertShift, int entity,
                           const std::vector<MVertex *> &allVert,
@@ -122,38 +127,48 @@ int CGNSZoneUnstruct::readSection(
   }
 #endif
 
-  // read connectivity data size
-  cgsize_t dataSize;
-  cgnsErr =
-    cg_ElementDataSize(fileIndex(), baseIndex(), index(), iSect, &dataSize);
-  if(cgnsErr != CG_OK) return cgnsError(__FILE__, __LINE__, fileIndex());
-
-  // read connectivity data
-  std::vector<cgsize_t> sectData(dataSize), offsetData(endElt - startElt + 2);
-  if(sectEltType == CGNS_ENUMV(MIXED)) {
+  // read connectivity data and create elements by chunks of elements, so that
+  // the raw connectivity of large sections is never held in memory at once
+  if(endElt > (cgsize_t)zoneElt.size()) zoneElt.resize(endElt);
+  std::vector<cgsize_t> sectData, offsetData;
+  for(cgsize_t chunkStart = startElt; chunkStart <= endElt;
+      chunkStart += cgnsElementChunkSize) {
+    const cgsize_t chunkEnd =
+      std::min(endElt, chunkStart + cgnsElementChunkSize - 1);
+
+    // read connectivity data size for the chunk
+    cgsize_t dataSize;
+    cgnsErr = cg_ElementPartialSize(fileIndex(), baseIndex(), index(), iSect,
+                                    chunkStart, chunkEnd, &dataSize);
+    if(cgnsErr != CG_OK) return cgnsError(__FILE__, __LINE__, fileIndex());
+
+    // read connectivity data for the chunk
+    sectData.resize(dataSize);
+    if(sectEltType == CGNS_ENUMV(MIXED)) {
 #if CGNS_VERSION >= 4000
-    cgnsErr =
-      cg_poly_elements_read(fileIndex(), baseIndex(), index(), iSect,
-                            sectData.data(), offsetData.data(), nullptr);
+      offsetData.resize(chunkEnd - chunkStart + 2);
+      cgnsErr = cg_poly_elements_partial_read(
+        fileIndex(), baseIndex(), index(), iSect, chunkStart, chunkEnd,
+        sectData.data(), offsetData.data(), nullptr);
 #endif
-  }
-  else {
-    cgnsErr = cg_elements_read(fileIndex(), baseIndex(), index(), iSect,
-                               sectData.data(), nullptr);
-  }
-  if(cgnsErr != CG_OK) return cgnsError(__FILE__, __LINE__, fileIndex());
-
-  // create elements
-  std::size_t iSectData = 0;
-  if(endElt > (cgsize_t)zoneElt.size()) zoneElt.resize(endElt);
-  const cgsize_t iStartElt = startElt - 1, iEndElt = endElt - 1;
-  for(int iElt = iStartElt; iElt <= iEndElt; iElt++) {
-    const auto it = elt2Geom().find(iElt);
-    const int entity = (it == elt2Geom().end()) ? 1 : it->second;
-    MElement *me =
-      createElement(sectEltType, startNode(), entity, allVert, allElt, sectData,
-                    eltNodeTransfo(), rawNode, iSectData);
-    zoneElt[iElt] = me;
+    }
+    else {
+      cgnsErr =
+        cg_elements_partial_read(fileIndex(), baseIndex(), index(), iSect,
+                                 chunkStart, chunkEnd, sectData.data(), nullptr);
+    }
+    if(cgnsErr != CG_OK) return cgnsError(__FILE__, __LINE__, fileIndex());
+
+    // create elements of the chunk
+    std::size_t iSectData = 0;
+    for(cgsize_t iElt = chunkStart - 1; iElt <= chunkEnd - 1; iElt++) {
+      const auto it = elt2Geom().find(iElt);
+      const int entity = (it == elt2Geom().end()) ? 1 : it->second;
+      MElement *me =
+        createElement(sectEltType, startNode(), entity, allVert, allElt,
+                      sectData, eltNodeTransfo(), rawNode, iSectData);
+      zoneElt[iElt] = me;
+    }
   }
 
   return 1;
@@ -58,6 +58,8 @@ void GEdge::deleteMesh()
   correspondingVertices.clear();
   correspondingHighOrderVertices.clear();
   deleteVertexArrays();
+  deleteMeshElementQualities();
+  deleteCompactConnectivity();
   model()->destroyMeshCaches();
 }
 
@@ -10,6 +10,7 @@
 #include "MElement.h"
 #include "VertexArray.h"
 #include "Context.h"
+#include "GmshMessage.h"
 #include "GVertex.h"
 #include "GEdge.h"
 #include "GFace.h"
@@ -19,7 +20,7 @@
 GEntity::GEntity(GModel *m, int t)
   : _model(m), _tag(t), _meshMaster(this), _visible(1), _selection(0),
     _onlySomeElementsVisible(1), _obb(nullptr), va_lines(nullptr),
-    va_triangles(nullptr)
+    va_triangles(nullptr), va_lines_lod(nullptr), va_triangles_lod(nullptr)
 {
   // default color when none is explicitly specified - don't change this, as it
   // is documented and used in scripts to detect if explicit colors are set
@@ -33,8 +34,81 @@ void GEntity::deleteVertexArrays()
   va_lines = nullptr;
   if(va_triangles) delete va_triangles;
   va_triangles = nullptr;
+  if(va_lines_lod) delete va_lines_lod;
+  va_lines_lod = nullptr;
+  if(va_triangles_lod) delete va_triangles_lod;
+  va_triangles_lod = nullptr;
 }
 
+const GEntity::compactConnectivity *
+GEntity::getCompactConnectivity(int familyType)
+{
+  if(!CTX::instance()->mesh.compactConnectivity) return nullptr;
+  const std::size_t num = getNumMeshElementsByType(familyType);
+  if(!num) return nullptr;
+  const std::size_t stamp = model()->getMeshCachesStamp();
+  auto it = _compactConnectivity.find(familyType);
+  if(it != _compactConnectivity.end() && it->second.stamp == stamp &&
+     it->second.numElements == num)
+    return it->second.data.empty() ? nullptr : &it->second;
+  // the result is cached even if the compact connectivity is not available
+  // (elements of different types, or without a fixed number of nodes), so
+  // that it is not rebuilt on each call
+  compactConnectivity &c = _compactConnectivity[familyType];
+  c.stamp = stamp;
+  c.numElements = num;
+  c.elementType = getMeshElementByType(familyType, 0)->getTypeForMSH();
+  c.numNodes = MElement::getInfoMSH(c.elementType);
+  c.data.clear();
+  if(c.numNodes <= 0) return nullptr;
+  const std::size_t n = 1 + c.numNodes;
+  c.data.resize(num * n);
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+  int sameType = 1;
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  reduction(&& : sameType)
+  for(int i = 0; i < (int)num; i++) {
+    MElement *e = getMeshElementByType(familyType, i);
+    if(e->getTypeForMSH() != c.elementType) {
+      sameType = 0;
+      continue;
+    }
+    std::size_t *d = &c.data[i * n];
+    d[0] = e->getNum();
+    for(int j = 0; j < c.numNodes; j++) d[1 + j] = e->getVertex(j)->getNum();
+  }
+  if(!sameType) {
+    std::vector<std::size_t>().swap(c.data);
+    return nullptr;
+  }
+  return &c;
+}
+
+void GEntity::deleteCompactConnectivity() { _compactConnectivity.clear(); }
+
+const std::vector<double> &
+GEntity::getMeshElementQualities(int familyType, int qualityMeasure)
+{
+  const std::size_t num = getNumMeshElementsByType(familyType);
+  const std::size_t stamp = model()->getMeshCachesStamp();
+  std::pair<std::size_t, std::vector<double> > &q =
+    _meshElementQualities[std::make_pair(familyType, qualityMeasure)];
+  if(q.first == stamp && q.second.size() == num) return q.second;
+  q.first = stamp;
+  q.second.resize(num);
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+  if(!MElement::isQualityMeasureThreadSafe(qualityMeasure)) nthreads = 1;
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+  for(int i = 0; i < (int)num; i++)
+    q.second[i] =
+      getMeshElementByType(familyType, i)->getQualityMeasure(qualityMeasure);
+  return q.second;
+}
+
+void GEntity::deleteMeshElementQualities() { _meshElementQualities.clear(); }
+
 char GEntity::getVisibility()
 {
   if(CTX::instance()->hideUnselected && !CTX::instance()->pickElements &&
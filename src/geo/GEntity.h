@@ -68,10 +68,32 @@ public: // these will become protected at some point
   // the vertex arrays to draw the mesh of the entity efficiently
   VertexArray *va_lines, *va_triangles;
 
+  // decimated versions of the vertex arrays (level of detail), if any
+  VertexArray *va_lines_lod, *va_triangles_lod;
+
   // the set of high-order elements fixed by the "fast curving" boundary layer
   // optimization
   std::set<MElement *> curvedBLElements;
 
+  // compact copy of the connectivity of the mesh elements of a family, all of
+  // type elementType: for each element, its tag followed by the tags of its
+  // numNodes nodes (i.e. the layout of element blocks in MSH4 files)
+  struct compactConnectivity {
+    int elementType, numNodes;
+    std::size_t stamp; // GModel::getMeshCachesStamp() when built
+    std::size_t numElements; // data is empty if not available
+    std::vector<std::size_t> data;
+  };
+
+private:
+  // the compact connectivities, by family type
+  std::map<int, compactConnectivity> _compactConnectivity;
+
+  // the cached quality measures of the mesh elements, by family type and
+  // quality measure index (with the GModel::getMeshCachesStamp() when built)
+  std::map<std::pair<int, int>, std::pair<std::size_t, std::vector<double> > >
+    _meshElementQualities;
+
 public:
   // make a set of all the vertices in the entity, with/without closure
   void addVerticesInSet(std::set<MVertex *> &, bool closure) const;
@@ -195,6 +217,29 @@ public:
   // delete the mesh vertex arrays, used to to draw the mesh efficiently
   void deleteVertexArrays();
 
+  // get the compact connectivity of the mesh elements of type familyType,
+  // built on demand if Mesh.CompactConnectivity is set; returns nullptr if it
+  // is not available (e.g. if the elements are not all of the same type). The
+  // copy is rebuilt if the mesh caches of the model have been destroyed or
+  // invalidated since it was built, i.e. code that reorders the elements in
+  // place must call GModel::invalidateMeshDataCaches(). Not thread-safe.
+  const compactConnectivity *getCompactConnectivity(int familyType);
+
+  // delete the compact connectivities
+  void deleteCompactConnectivity();
+
+  // get the quality measure of index qualityMeasure (see
+  // MElement::getQualityMeasureIndex()) of the mesh elements of type
+  // familyType, in the order of getMeshElementByType(). The values are
+  // computed in parallel on demand, and are cached until the mesh caches of
+  // the model are destroyed or its mesh data caches are invalidated (i.e. if
+  // elements or nodes have changed). Not thread-safe.
+  const std::vector<double> &getMeshElementQualities(int familyType,
+                                                     int qualityMeasure);
+
+  // delete the cached quality measures (done when the mesh is deleted)
+  void deleteMeshElementQualities();
+
   // delete the geometry vertex arrays, used to to draw the geometry efficiently
   virtual void deleteGeometryVertexArrays() {}
 
@@ -21,6 +21,7 @@
 #include "discreteEdge.h"
 #include "discreteFace.h"
 #include "ExtrudeParams.h"
+#include "SPoint3KDTree.h"
 
 #if defined(HAVE_MESH)
 #include "meshGFace.h"
@@ -42,8 +43,9 @@
 #endif
 
 GFace::GFace(GModel *model, int tag)
-  : GEntity(model, tag), r1(nullptr), r2(nullptr), va_geom_triangles(nullptr),
-    compoundSurface(nullptr)
+  : GEntity(model, tag), _projectionCache(nullptr), _projectionQueries(0),
+    _projectionHits(0), _projectionIterations(0), r1(nullptr), r2(nullptr),
+    va_geom_triangles(nullptr), compoundSurface(nullptr)
 {
   meshStatistics.status = GFace::PENDING;
   meshStatistics.refineAllEdges = false;
@@ -56,6 +58,8 @@ GFace::~GFace()
 
   if(va_geom_triangles) delete va_geom_triangles;
 
+  deleteProjectionCache();
+
   GFace::deleteMesh();
 }
 
@@ -151,6 +155,8 @@ void GFace::deleteMesh()
   correspondingVertices.clear();
   correspondingHighOrderVertices.clear();
   deleteVertexArrays();
+  deleteMeshElementQualities();
+  deleteCompactConnectivity();
   model()->destroyMeshCaches();
 }
 
@@ -1046,6 +1052,23 @@ void GFace::XYZtoUV(double X, double Y, double Z, double &U, double &V,
 {
   if(geomType() == BoundaryLayerSurface) return;
 
+  // if the projection cache is enabled, start with the initial guess it
+  // provides, before trying the regular grid of initial guesses
+  double guess[2];
+  const bool cached = getProjectionInitialGuess(SPoint3(X, Y, Z), guess);
+  std::size_t numIter = 0;
+  bool hit = false;
+  _XYZtoUV(X, Y, Z, U, V, relax, onSurface, convTestXYZ,
+           cached ? guess : nullptr, numIter, hit);
+  if(cached) _addProjectionStatistics(hit, numIter);
+}
+
+void GFace::_XYZtoUV(double X, double Y, double Z, double &U, double &V,
+                     double relax, bool onSurface, bool convTestXYZ,
+                     const double *guess, std::size_t &numIter,
+                     bool &hit) const
+{
+
   const double Precision = onSurface ? 1.e-8 : 1.e-3;
   const int MaxIter = onSurface ? 25 : 10;
   const int NumInitGuess = 9;
@@ -1074,17 +1097,21 @@ void GFace::XYZtoUV(double X, double Y, double Z, double &U, double &V,
     initv[i] = vmin + initv[i] * (vmax - vmin);
   }
 
-  for(int i = 0; i < NumInitGuess; i++) {
-    for(int j = 0; j < NumInitGuess; j++) {
-      U = initu[i];
-      V = initv[j];
+  // start with the initial guess from the projection cache (i = -1), if any
+  for(int i = guess ? -1 : 0; i < NumInitGuess; i++) {
+    for(int j = 0; j < (i < 0 ? 1 : NumInitGuess); j++) {
+      U = (i < 0) ? guess[0] : initu[i];
+      V = (i < 0) ? guess[1] : initv[j];
       err = 1.0;
       iter = 1;
 
       GPoint P = point(U, V);
       err2 = std::sqrt(std::pow(X - P.x(), 2) + std::pow(Y - P.y(), 2) +
                        std::pow(Z - P.z(), 2));
-      if(err2 < 1.e-8 * CTX::instance()->lc) return;
+      if(err2 < 1.e-8 * CTX::instance()->lc) {
+        hit = (i < 0);
+        return;
+      }
 
       while(err > tol && iter < MaxIter) {
         P = point(U, V);
@@ -1118,6 +1145,7 @@ void GFace::XYZtoUV(double X, double Y, double Z, double &U, double &V,
         U = Unew;
         V = Vnew;
       }
+      numIter += iter - 1;
 
       if(iter < MaxIter && err <= tol && Unew <= umax && Vnew <= vmax &&
          Unew >= umin && Vnew >= vmin) {
@@ -1131,6 +1159,7 @@ void GFace::XYZtoUV(double X, double Y, double Z, double &U, double &V,
           // not converged in XYZ coordinates: try again
         }
         else {
+          hit = (i < 0);
           return;
         }
       }
@@ -1143,8 +1172,110 @@ void GFace::XYZtoUV(double X, double Y, double Z, double &U, double &V,
     Msg::Warning("Inverse surface mapping could not converge");
   else {
     Msg::Info("Point %g %g %g: Relaxation factor = %g", X, Y, Z, 0.75 * relax);
-    XYZtoUV(X, Y, Z, U, V, 0.75 * relax, onSurface, convTestXYZ);
+    _XYZtoUV(X, Y, Z, U, V, 0.75 * relax, onSurface, convTestXYZ, guess,
+             numIter, hit);
+  }
+}
+
+struct GFace::projectionCache {
+  int size;
+  SPoint3Cloud pc;
+  SPoint3CloudAdaptor<SPoint3Cloud> pc2kdtree;
+  SPoint3KDTree *kdtree;
+  std::vector<SPoint2> uv;
+  projectionCache(int n) : size(n), pc2kdtree(pc), kdtree(nullptr) {}
+  ~projectionCache()
+  {
+    if(kdtree) delete kdtree;
+  }
+};
+
+const GFace::projectionCache *GFace::_getProjectionCache() const
+{
+  const int n = CTX::instance()->geom.projectionCacheSize;
+  if(n <= 0 || geomType() == BoundaryLayerSurface) return nullptr;
+  projectionCache *c = _projectionCache.load(std::memory_order_acquire);
+  if(c && c->size == n) return c;
+  // the cache is (re)built if it does not exist or if the size changed (the
+  // option is not changed during parallel sections, so that no other thread
+  // can still use a cache with the old size); it is not stored if no point
+  // could be sampled, e.g. if the geometry of the surface is not ready yet
+#pragma omp critical(GFaceProjectionCache)
+  {
+    c = _projectionCache.load(std::memory_order_acquire);
+    if(!c || c->size != n) {
+      c = new projectionCache(n);
+      Range<double> ru = parBounds(0);
+      Range<double> rv = parBounds(1);
+      for(int i = 0; i <= n; i++) {
+        const double u = ru.low() + (ru.high() - ru.low()) * i / n;
+        for(int j = 0; j <= n; j++) {
+          const double v = rv.low() + (rv.high() - rv.low()) * j / n;
+          GPoint p = point(u, v);
+          if(!p.succeeded()) continue;
+          c->pc.pts.push_back(SPoint3(p.x(), p.y(), p.z()));
+          c->uv.push_back(SPoint2(u, v));
+        }
+      }
+      if(c->pc.pts.size()) {
+        c->kdtree = new SPoint3KDTree(
+          3, c->pc2kdtree, nanoflann::KDTreeSingleIndexAdaptorParams(10));
+        c->kdtree->buildIndex();
+        Msg::Debug("Built projection cache of surface %d with %lu points",
+                   tag(), c->pc.pts.size());
+        projectionCache *old = _projectionCache.exchange(c);
+        if(old) delete old;
+      }
+      else {
+        delete c;
+        c = nullptr;
+      }
+    }
   }
+  return c;
+}
+
+bool GFace::getProjectionInitialGuess(const SPoint3 &p, double uv[2]) const
+{
+  const projectionCache *c = _getProjectionCache();
+  if(!c) return false;
+  std::size_t idx = 0;
+  double squ_dist = 0.;
+  nanoflann::KNNResultSet<double> resultSet(1);
+  resultSet.init(&idx, &squ_dist);
+  c->kdtree->findNeighbors(resultSet, p.data(), nanoflann::SearchParams(10));
+  if(!resultSet.size() || idx >= c->uv.size()) return false;
+  uv[0] = c->uv[idx].x();
+  uv[1] = c->uv[idx].y();
+  return true;
+}
+
+void GFace::deleteProjectionCache()
+{
+  projectionCache *c = _projectionCache.exchange(nullptr);
+  if(c) delete c;
+}
+
+void GFace::_addProjectionStatistics(bool hit, std::size_t iterations) const
+{
+  _projectionQueries++;
+  if(hit) _projectionHits++;
+  _projectionIterations += iterations;
+}
+
+void GFace::resetProjectionStatistics()
+{
+  _projectionQueries = 0;
+  _projectionHits = 0;
+  _projectionIterations = 0;
+}
+
+void GFace::getProjectionStatistics(std::size_t &queries, std::size_t &hits,
+                                    std::size_t &iterations) const
+{
+  queries = _projectionQueries;
+  hits = _projectionHits;
+  iterations = _projectionIterations;
 }
 
 SPoint2 GFace::parFromPoint(const SPoint3 &p, bool onSurface,
@@ -1218,22 +1349,36 @@ GPoint GFace::closestPoint(const SPoint3 &queryPoint,
   SPoint3 spnt(pnt.x(), pnt.y(), pnt.z());
   double min_dist = queryPoint.distance(spnt);
 
-  // Try to find a better initial guess by sampling full parameter range
-  const double nGuesses = 10.;
-  const Range<double> uu = parBounds(0);
-  const Range<double> vv = parBounds(1);
-  const double ru = uu.high() - uu.low(), rv = vv.high() - vv.low();
-  const double epsU = 1e-5 * ru, epsV = 1e-5 * rv;
-  const double du = ru / nGuesses, dv = rv / nGuesses;
-  for(double u = uu.low(); u <= uu.high() + epsU; u += du) {
-    for(double v = vv.low(); v <= vv.high() + epsV; v += dv) {
-      GPoint pnt = point(u, v);
-      SPoint3 spnt(pnt.x(), pnt.y(), pnt.z());
-      double dist = queryPoint.distance(spnt);
-      if(dist < min_dist) {
-        min_dist = dist;
-        min_u = u;
-        min_v = v;
+  // Try to find a better initial guess, from the projection cache if it is
+  // enabled, or by sampling full parameter range
+  double guess[2];
+  if(getProjectionInitialGuess(queryPoint, guess)) {
+    GPoint pnt = point(guess[0], guess[1]);
+    SPoint3 spnt(pnt.x(), pnt.y(), pnt.z());
+    double dist = queryPoint.distance(spnt);
+    if(dist < min_dist) {
+      min_dist = dist;
+      min_u = guess[0];
+      min_v = guess[1];
+    }
+  }
+  else {
+    const double nGuesses = 10.;
+    const Range<double> uu = parBounds(0);
+    const Range<double> vv = parBounds(1);
+    const double ru = uu.high() - uu.low(), rv = vv.high() - vv.low();
+    const double epsU = 1e-5 * ru, epsV = 1e-5 * rv;
+    const double du = ru / nGuesses, dv = rv / nGuesses;
+    for(double u = uu.low(); u <= uu.high() + epsU; u += du) {
+      for(double v = vv.low(); v <= vv.high() + epsV; v += dv) {
+        GPoint pnt = point(u, v);
+        SPoint3 spnt(pnt.x(), pnt.y(), pnt.z());
+        double dist = queryPoint.distance(spnt);
+        if(dist < min_dist) {
+          min_dist = dist;
+          min_u = u;
+          min_v = v;
+        }
       }
     }
   }
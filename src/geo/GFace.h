@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <atomic>
 #include "GmshDefines.h"
 #include "GEntity.h"
 #include "GPoint.h"
@@ -30,7 +31,28 @@ class GRegion;
 
 // A model face.
 class GFace : public GEntity {
+private:
+  // sampling of the surface on a regular grid of its parameter plane, with a
+  // kdtree of the sampled points, used to compute initial guesses for the
+  // inverse mapping of points (see Geometry.ProjectionCacheSize); built on
+  // first use (and rebuilt if the size changes), then accessed without locking
+  struct projectionCache;
+  mutable std::atomic<projectionCache *> _projectionCache;
+  const projectionCache *_getProjectionCache() const;
+  // number of inverse mappings started from the cached initial guess, number
+  // of those that converged from it, and number of Newton iterations
+  mutable std::atomic<std::size_t> _projectionQueries, _projectionHits;
+  mutable std::atomic<std::size_t> _projectionIterations;
+  // inverse mapping, starting with the initial guess if not null, and
+  // accumulating the Newton iterations over the relaxed attempts
+  void _XYZtoUV(double X, double Y, double Z, double &U, double &V,
+                double relax, bool onSurface, bool convTestXYZ,
+                const double *guess, std::size_t &numIter, bool &hit) const;
+
 protected:
+  // record an inverse mapping started from the cached initial guess
+  void _addProjectionStatistics(bool hit, std::size_t iterations) const;
+
   // edge loops might replace what follows (list of all the edges of
   // the face + directions)
   std::vector<GEdge *> l_edges;
@@ -190,6 +212,20 @@ public:
   virtual SPoint2 parFromPoint(const SPoint3 &, bool onSurface = true,
                                bool convTestXYZ = false) const;
 
+  // get an initial guess for the parametric coordinates of the point of the
+  // surface closest to p, from the cached sampling of the surface; return
+  // false if the cache is disabled or empty
+  bool getProjectionInitialGuess(const SPoint3 &p, double uv[2]) const;
+
+  // delete the cached sampling of the surface, e.g. if the surface changed
+  void deleteProjectionCache();
+
+  // reset and get the statistics of the inverse mappings using the cached
+  // sampling
+  void resetProjectionStatistics();
+  void getProjectionStatistics(std::size_t &queries, std::size_t &hits,
+                               std::size_t &iterations) const;
+
   // true if the parameter value is interior to the face
   virtual bool containsParam(const SPoint2 &pt);
 
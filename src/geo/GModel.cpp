@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <sstream>
 #include <stack>
+#include <stdexcept>
 #include "GmshConfig.h"
 #include "GmshMessage.h"
 #include "GModel.h"
@@ -70,7 +71,7 @@ std::vector<GModel *> GModel::list;
 int GModel::_current = -1;
 
 GModel::GModel(const std::string &name)
-  : _name(name), _visible(1), _elementOctree(nullptr),
+  : _name(name), _visible(1), _elementOctree(nullptr), _meshCachesStamp(0),
     _geo_internals(nullptr), _occ_internals(nullptr), _acis_internals(nullptr),
     _parasolid_internals(nullptr), _fields(nullptr),
     _currentMeshEntity(nullptr), _numPartitions(0), normals(nullptr),
@@ -230,6 +231,7 @@ void GModel::destroyMeshCaches()
       delete _elementOctree;
       _elementOctree = nullptr;
     }
+    _meshCachesStamp++;
   }
 }
 
@@ -1138,11 +1140,29 @@ SBoundingBox3d GModel::bounds(bool aroundVisible)
 {
   std::vector<GEntity *> entities;
   getEntities(entities);
+
+  // the bounding boxes of OpenCASCADE entities are costly to compute on large
+  // models: compute them in parallel, except if they are computed from the STL
+  // triangulation, which is not thread-safe
+  const bool occParallel = !CTX::instance()->geom.occBoundsUseSTL;
+  std::vector<SBoundingBox3d> occBounds;
+  if(occParallel) {
+    occBounds.resize(entities.size());
+    int nthreads = CTX::instance()->numThreads;
+    if(!nthreads) nthreads = Msg::GetMaxThreads();
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+    for(int i = 0; i < (int)entities.size(); i++) {
+      if((!aroundVisible || entities[i]->getVisibility()) &&
+         entities[i]->getNativeType() == GEntity::OpenCascadeModel)
+        occBounds[i] = entities[i]->bounds();
+    }
+  }
+
   SBoundingBox3d bb;
   for(std::size_t i = 0; i < entities.size(); i++) {
     if(!aroundVisible || entities[i]->getVisibility()) {
       if(entities[i]->getNativeType() == GEntity::OpenCascadeModel) {
-        bb += entities[i]->bounds();
+        bb += occParallel ? occBounds[i] : entities[i]->bounds();
       }
       else {
         // using the mesh vertices for now
@@ -1462,6 +1482,10 @@ int GModel::adaptMesh(std::vector<int> technique,
         }
       }
 
+      // elements have been remeshed and nodes smoothed: invalidate the cached
+      // data computed from the mesh
+      invalidateMeshDataCaches();
+
       char name[256];
       sprintf(name, "meshAdapt-%d.msh", ITER);
       writeMSH(name);
@@ -2567,13 +2591,35 @@ void GModel::createGeometryOfDiscreteEntities(
     Msg::StatusBar(true, "Creating geometry of discrete surfaces...");
     double t1 = Cpu(), w1 = TimeOfDay();
     Msg::StartProgressMeter(f.size());
-    for(std::size_t i = 0; i < f.size(); i++) {
-      Msg::ProgressMeter(i, true, "Creating geometry");
-      if(f[i]->createGeometry())
-        Msg::Error("Could not create geometry of discrete surface %d",
-                   f[i]->tag());
+    // the parametrizations of the surfaces are independent (each one solves
+    // its own linear system), and can thus be computed in parallel - except
+    // with PETSc, which is not thread-safe
+#if defined(HAVE_PETSC)
+    int nthreads = 1;
+#else
+    int nthreads = CTX::instance()->numThreads;
+    if(!nthreads) nthreads = Msg::GetMaxThreads();
+#endif
+    int nDone = 0;
+    bool exceptions = false;
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+    for(int i = 0; i < (int)f.size(); i++) {
+      if(exceptions) continue;
+      int localDone = 0;
+#pragma omp atomic capture
+      localDone = nDone++;
+      Msg::ProgressMeter(localDone, true, "Creating geometry");
+      try { // OpenMP forbids leaving block via exception
+        if(f[i]->createGeometry())
+          Msg::Error("Could not create geometry of discrete surface %d",
+                     f[i]->tag());
+      }
+      catch(...) {
+        exceptions = true;
+      }
     }
     Msg::StopProgressMeter();
+    if(exceptions) throw std::runtime_error(Msg::GetLastError());
     double t2 = Cpu();
     double w2 = TimeOfDay();
     Msg::StatusBar(true,
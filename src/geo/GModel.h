@@ -112,6 +112,10 @@ protected:
   // an octree for fast mesh element lookup
   MElementOctree *_elementOctree;
 
+  // incremented each time the mesh caches are destroyed, so that caches
+  // stored in the entities can detect that the mesh has changed
+  std::size_t _meshCachesStamp;
+
   // global cache storage of discrete curvatures
   std::map<MVertex *, std::pair<SVector3, SVector3> > _curvatures;
 
@@ -302,6 +306,12 @@ public:
   // delete all the mesh-related caches (this must be called when the
   // mesh is changed)
   void destroyMeshCaches();
+  std::size_t getMeshCachesStamp() const { return _meshCachesStamp; }
+  // invalidate the data computed from the mesh and cached on the entities
+  // (e.g. the element quality measures) without destroying the node and
+  // element caches: this must be called when nodes are moved or when elements
+  // are reordered in place
+  void invalidateMeshDataCaches() { _meshCachesStamp++; }
   // delete the mesh stored in entities and call destroMeshCaches
   void deleteMesh();
   void deleteMesh(const std::vector<GEntity *> &entities);
@@ -883,6 +893,15 @@ public:
   int writeVTK(const std::string &name, bool binary = false,
                bool saveAll = false, double scalingFactor = 1.0,
                bool bigEndian = false);
+  // VTK XML unstructured grid format (raw appended data if binary); for
+  // partitioned meshes, writePartitionedVTU() writes one file per partition,
+  // and a .pvtu file referencing them
+  int writeVTU(const std::string &name, bool binary = false,
+               bool saveAll = false, double scalingFactor = 1.0,
+               bool bigEndian = false);
+  int writePartitionedVTU(const std::string &baseName, bool binary = false,
+                          bool saveAll = false, double scalingFactor = 1.0,
+                          bool bigEndian = false);
   // conch add
   int writeVTKSteam(std::ostream &os, bool binary = false, bool saveAll = false,
                     double scalingFactor = 1.0, bool bigEndian = false);
@@ -2505,6 +2505,31 @@ static void writeMSH4Elements(GModel *const model, FILE *fp, bool partitioned,
       }
 
       std::size_t N = it->second.size();
+
+      // stream directly over the compact connectivity of the entity, if
+      // available and if the block contains all the elements of the family
+      // (not for polygons and polyhedra, which have no fixed number of nodes)
+      const GEntity::compactConnectivity *cc = nullptr;
+      GEntity *ge = model->getEntityByTag(dim, entityTag);
+      if(ge && MElement::getInfoMSH(elmType) > 0) {
+        cc = ge->getCompactConnectivity(ElementType::getParentType(elmType));
+        if(cc && (cc->elementType != elmType ||
+                  cc->data.size() != N * (1 + cc->numNodes)))
+          cc = nullptr;
+      }
+      if(cc) {
+        const std::size_t n = 1 + cc->numNodes;
+        if(binary) { fwrite(&cc->data[0], sizeof(std::size_t), N * n, fp); }
+        else {
+          for(std::size_t i = 0; i < N; i++) {
+            for(std::size_t j = 0; j < n; j++)
+              fprintf(fp, "%lu ", cc->data[i * n + j]);
+            fprintf(fp, "\n");
+          }
+        }
+        continue;
+      }
+
       if(binary) {
         const int numVertPerElm = MElement::getInfoMSH(elmType);
         std::size_t n = 1 + numVertPerElm;
@@ -172,6 +172,7 @@ OCC_Internals::OCC_Internals()
   for(int i = 0; i < 6; i++)
     _maxTag[i] = CTX::instance()->geom.firstEntityTag - 1;
   _changed = true;
+  _mapsUpToDate = false;
   _attributes = new OCCAttributesRTree(CTX::instance()->geom.tolerance);
 }
 
@@ -180,12 +181,9 @@ OCC_Internals::~OCC_Internals() { delete _attributes; }
 void OCC_Internals::reset()
 {
   _attributes->clear();
-  _somap.Clear();
-  _shmap.Clear();
-  _fmap.Clear();
-  _wmap.Clear();
-  _emap.Clear();
-  _vmap.Clear();
+  _clearMaps();
+  for(int dim = 0; dim < 4; dim++)
+    std::vector<TopoDS_Shape>().swap(_toSync[dim]);
   _unbind();
 }
 
@@ -231,12 +229,14 @@ void OCC_Internals::_bind(const TopoDS_Vertex &vertex, int tag, bool recursive)
     if(_tagVertex.IsBound(tag)) {
       // this leaves the old vertex bound in _vertexTag, but we cannot remove it
       Msg::Info("Rebinding OpenCASCADE point %d", tag);
+      _mapsUpToDate = false;
     }
     _vertexTag.Bind(vertex, tag);
     _tagVertex.Bind(tag, vertex);
     setMaxTag(0, tag);
     _changed = true;
     _attributes->insert(new OCCAttributes(0, vertex));
+    _toSync[0].push_back(vertex);
   }
 }
 
@@ -253,12 +253,14 @@ void OCC_Internals::_bind(const TopoDS_Edge &edge, int tag, bool recursive)
     if(_tagEdge.IsBound(tag)) {
       // this leaves the old edge bound in _edgeTag, but we cannot remove it
       Msg::Info("Rebinding OpenCASCADE curve %d", tag);
+      _mapsUpToDate = false;
     }
     _edgeTag.Bind(edge, tag);
     _tagEdge.Bind(tag, edge);
     setMaxTag(1, tag);
     _changed = true;
     _attributes->insert(new OCCAttributes(1, edge));
+    _toSync[1].push_back(edge);
   }
   if(recursive) {
     TopExp_Explorer exp0;
@@ -316,12 +318,14 @@ void OCC_Internals::_bind(const TopoDS_Face &face, int tag, bool recursive)
     if(_tagFace.IsBound(tag)) {
       // this leaves the old face bound in _faceTag, but we cannot remove it
       Msg::Info("Rebinding OpenCASCADE surface %d", tag);
+      _mapsUpToDate = false;
     }
     _faceTag.Bind(face, tag);
     _tagFace.Bind(tag, face);
     setMaxTag(2, tag);
     _changed = true;
     _attributes->insert(new OCCAttributes(2, face));
+    _toSync[2].push_back(face);
   }
   if(recursive) {
     TopExp_Explorer exp0;
@@ -386,12 +390,14 @@ void OCC_Internals::_bind(const TopoDS_Solid &solid, int tag, bool recursive)
     if(_tagSolid.IsBound(tag)) {
       // this leaves the old solid bound in _solidTag, but we cannot remove it
       Msg::Info("Rebinding OpenCASCADE volume %d", tag);
+      _mapsUpToDate = false;
     }
     _solidTag.Bind(solid, tag);
     _tagSolid.Bind(tag, solid);
     setMaxTag(3, tag);
     _changed = true;
     _attributes->insert(new OCCAttributes(3, solid));
+    _toSync[3].push_back(solid);
   }
   if(recursive) {
     TopExp_Explorer exp0;
@@ -5438,6 +5444,40 @@ bool const sortByInvDim(std::pair<int, int> const &lhs,
   return lhs.first > rhs.first;
 }
 
+// get the mesh size, the first label and the color of all the shapes in map:
+// the searches in the attribute tree are independent, and are the most costly
+// part of the synchronization of large models, so do them in parallel
+static void getAttributesOfShapes(OCCAttributesRTree *attributes, int dim,
+                                  const TopTools_IndexedMapOfShape &map,
+                                  std::vector<double> &lc,
+                                  std::vector<std::string> &label,
+                                  std::vector<unsigned int> &col,
+                                  std::vector<unsigned int> &boundary,
+                                  std::vector<char> &hasColor)
+{
+  const int n = map.Extent();
+  lc.assign(n, MAX_LC);
+  label.assign(n, "");
+  col.assign(n, 0);
+  boundary.assign(n, 0);
+  hasColor.assign(n, 0);
+
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+  for(int i = 0; i < n; i++) {
+    try {
+      std::vector<std::string> labels;
+      hasColor[i] = attributes->getMeshSizeLabelsAndColor(
+        dim, map(i + 1), lc[i], labels, col[i], boundary[i]);
+      if(labels.size()) label[i] = labels[0];
+    } catch(Standard_Failure &err) {
+      Msg::Error("OpenCASCADE exception %s", err.GetMessageString());
+    }
+  }
+}
+
 void OCC_Internals::synchronize(GModel *model)
 {
   Msg::Debug("Syncing OCC_Internals with GModel");
@@ -5454,30 +5494,42 @@ void OCC_Internals::synchronize(GModel *model)
   model->remove(toRemove, removed);
   Msg::Debug("Destroying %lu entities in model", removed.size());
   for(std::size_t i = 0; i < removed.size(); i++) delete removed[i];
-  _toRemove.clear();
 
-  // iterate over all shapes with tags, and import them into the (sub)shape
-  // _maps
-  _somap.Clear();
-  _shmap.Clear();
-  _fmap.Clear();
-  _wmap.Clear();
-  _emap.Clear();
-  _vmap.Clear();
-  TopTools_DataMapIteratorOfDataMapOfIntegerShape exp0(_tagVertex);
-  for(; exp0.More(); exp0.Next()) _addShapeToMaps(exp0.Value());
-  TopTools_DataMapIteratorOfDataMapOfIntegerShape exp1(_tagEdge);
-  for(; exp1.More(); exp1.Next()) _addShapeToMaps(exp1.Value());
-  TopTools_DataMapIteratorOfDataMapOfIntegerShape exp2(_tagFace);
-  for(; exp2.More(); exp2.Next()) _addShapeToMaps(exp2.Value());
-  TopTools_DataMapIteratorOfDataMapOfIntegerShape exp3(_tagSolid);
-  for(; exp3.More(); exp3.Next()) _addShapeToMaps(exp3.Value());
+  // import all the shapes with tags into the (sub)shape _maps; if no shape has
+  // been unbound since the last synchronization, the maps only need to be
+  // completed with the shapes bound since then
+  if(_mapsUpToDate && _toRemove.empty()) {
+    Msg::Debug("Sync is adding %lu new shapes",
+               _toSync[0].size() + _toSync[1].size() + _toSync[2].size() +
+                 _toSync[3].size());
+    for(int dim = 0; dim < 4; dim++) {
+      for(std::size_t i = 0; i < _toSync[dim].size(); i++)
+        _addShapeToMaps(_toSync[dim][i]);
+    }
+  }
+  else {
+    _clearMaps();
+    TopTools_DataMapIteratorOfDataMapOfIntegerShape exp0(_tagVertex);
+    for(; exp0.More(); exp0.Next()) _addShapeToMaps(exp0.Value());
+    TopTools_DataMapIteratorOfDataMapOfIntegerShape exp1(_tagEdge);
+    for(; exp1.More(); exp1.Next()) _addShapeToMaps(exp1.Value());
+    TopTools_DataMapIteratorOfDataMapOfIntegerShape exp2(_tagFace);
+    for(; exp2.More(); exp2.Next()) _addShapeToMaps(exp2.Value());
+    TopTools_DataMapIteratorOfDataMapOfIntegerShape exp3(_tagSolid);
+    for(; exp3.More(); exp3.Next()) _addShapeToMaps(exp3.Value());
+  }
+  _toRemove.clear();
 
   // import all shapes in _maps into the GModel, preserving all explicit tags
   int vTagMax = std::max(model->getMaxElementaryNumber(0), getMaxTag(0));
   int eTagMax = std::max(model->getMaxElementaryNumber(1), getMaxTag(1));
   int fTagMax = std::max(model->getMaxElementaryNumber(2), getMaxTag(2));
   int rTagMax = std::max(model->getMaxElementaryNumber(3), getMaxTag(3));
+  std::vector<double> lc;
+  std::vector<std::string> label;
+  std::vector<unsigned int> col, boundary;
+  std::vector<char> hasColor;
+  std::vector<GVertex *> vertices(_vmap.Extent());
   for(int i = 1; i <= _vmap.Extent(); i++) {
     TopoDS_Vertex vertex = TopoDS::Vertex(_vmap(i));
     GVertex *occv = getVertexForOCCShape(model, vertex);
@@ -5493,16 +5545,17 @@ void OCC_Internals::synchronize(GModel *model)
       occv = new OCCVertex(model, vertex, tag);
       model->add(occv);
     }
-    double lc = _attributes->getMeshSize(0, vertex);
-    if(lc != MAX_LC) occv->setPrescribedMeshSizeAtVertex(lc);
-    std::vector<std::string> labels;
-    _attributes->getLabels(0, vertex, labels);
-    if(labels.size()) model->setElementaryName(0, occv->tag(), labels[0]);
-    unsigned int col = 0, boundary = 0;
-    if(!occv->useColor() && _attributes->getColor(0, vertex, col, boundary)) {
-      occv->setColor(col);
-    }
+    vertices[i - 1] = occv;
   }
+  getAttributesOfShapes(_attributes, 0, _vmap, lc, label, col, boundary,
+                        hasColor);
+  for(std::size_t i = 0; i < vertices.size(); i++) {
+    GVertex *occv = vertices[i];
+    if(lc[i] != MAX_LC) occv->setPrescribedMeshSizeAtVertex(lc[i]);
+    if(label[i].size()) model->setElementaryName(0, occv->tag(), label[i]);
+    if(!occv->useColor() && hasColor[i]) occv->setColor(col[i]);
+  }
+  std::vector<GEdge *> edges(_emap.Extent());
   for(int i = 1; i <= _emap.Extent(); i++) {
     TopoDS_Edge edge = TopoDS::Edge(_emap(i));
     GEdge *occe = getEdgeForOCCShape(model, edge);
@@ -5521,14 +5574,16 @@ void OCC_Internals::synchronize(GModel *model)
       model->add(occe);
     }
     _copyExtrudedAttributes(edge, occe);
-    std::vector<std::string> labels;
-    _attributes->getLabels(1, edge, labels);
-    if(labels.size()) model->setElementaryName(1, occe->tag(), labels[0]);
-    unsigned int col = 0, boundary = 0;
-    if(!occe->useColor() && _attributes->getColor(1, edge, col, boundary)) {
-      occe->setColor(col);
-    }
+    edges[i - 1] = occe;
   }
+  getAttributesOfShapes(_attributes, 1, _emap, lc, label, col, boundary,
+                        hasColor);
+  for(std::size_t i = 0; i < edges.size(); i++) {
+    GEdge *occe = edges[i];
+    if(label[i].size()) model->setElementaryName(1, occe->tag(), label[i]);
+    if(!occe->useColor() && hasColor[i]) occe->setColor(col[i]);
+  }
+  std::vector<GFace *> faces(_fmap.Extent());
   for(int i = 1; i <= _fmap.Extent(); i++) {
     TopoDS_Face face = TopoDS::Face(_fmap(i));
     GFace *occf = getFaceForOCCShape(model, face);
@@ -5545,20 +5600,24 @@ void OCC_Internals::synchronize(GModel *model)
       model->add(occf);
     }
     _copyExtrudedAttributes(face, occf);
-    std::vector<std::string> labels;
-    _attributes->getLabels(2, face, labels);
-    if(labels.size()) model->setElementaryName(2, occf->tag(), labels[0]);
-    unsigned int col = 0, boundary = 0;
-    if(!occf->useColor() && _attributes->getColor(2, face, col, boundary)) {
-      occf->setColor(col);
-      if(boundary == 2) {
-        std::vector<GEdge *> edges = occf->edges();
-        for(std::size_t j = 0; j < edges.size(); j++) {
-          if(!edges[j]->useColor()) edges[j]->setColor(col);
+    faces[i - 1] = occf;
+  }
+  getAttributesOfShapes(_attributes, 2, _fmap, lc, label, col, boundary,
+                        hasColor);
+  for(std::size_t i = 0; i < faces.size(); i++) {
+    GFace *occf = faces[i];
+    if(label[i].size()) model->setElementaryName(2, occf->tag(), label[i]);
+    if(!occf->useColor() && hasColor[i]) {
+      occf->setColor(col[i]);
+      if(boundary[i] == 2) {
+        std::vector<GEdge *> e = occf->edges();
+        for(std::size_t j = 0; j < e.size(); j++) {
+          if(!e[j]->useColor()) e[j]->setColor(col[i]);
         }
       }
     }
   }
+  std::vector<GRegion *> regions(_somap.Extent());
   for(int i = 1; i <= _somap.Extent(); i++) {
     TopoDS_Solid region = TopoDS::Solid(_somap(i));
     GRegion *occr = getRegionForOCCShape(model, region);
@@ -5575,26 +5634,33 @@ void OCC_Internals::synchronize(GModel *model)
       model->add(occr);
     }
     _copyExtrudedAttributes(region, occr);
-    std::vector<std::string> labels;
-    _attributes->getLabels(3, region, labels);
-    if(labels.size()) model->setElementaryName(3, occr->tag(), labels[0]);
-    unsigned int col = 0, boundary = 0;
-    if(!occr->useColor() && _attributes->getColor(3, region, col, boundary)) {
-      occr->setColor(col);
-      if(boundary == 1) {
-        std::vector<GFace *> faces = occr->faces();
-        for(std::size_t j = 0; j < faces.size(); j++) {
-          if(!faces[j]->useColor()) faces[j]->setColor(col);
+    regions[i - 1] = occr;
+  }
+  getAttributesOfShapes(_attributes, 3, _somap, lc, label, col, boundary,
+                        hasColor);
+  for(std::size_t i = 0; i < regions.size(); i++) {
+    GRegion *occr = regions[i];
+    if(label[i].size()) model->setElementaryName(3, occr->tag(), label[i]);
+    if(!occr->useColor() && hasColor[i]) {
+      occr->setColor(col[i]);
+      if(boundary[i] == 1) {
+        std::vector<GFace *> f = occr->faces();
+        for(std::size_t j = 0; j < f.size(); j++) {
+          if(!f[j]->useColor()) f[j]->setColor(col[i]);
         }
       }
-      else if(boundary == 2) {
-        std::vector<GEdge *> edges = occr->edges();
-        for(std::size_t j = 0; j < edges.size(); j++) {
-          if(!edges[j]->useColor()) edges[j]->setColor(col);
+      else if(boundary[i] == 2) {
+        std::vector<GEdge *> e = occr->edges();
+        for(std::size_t j = 0; j < e.size(); j++) {
+          if(!e[j]->useColor()) e[j]->setColor(col[i]);
         }
       }
     }
   }
+  // all the bound shapes are now in the maps
+  _mapsUpToDate = true;
+  for(int dim = 0; dim < 4; dim++)
+    std::vector<TopoDS_Shape>().swap(_toSync[dim]);
 
   // if fuzzy boolean tolerance was used, some vertex positions should be
   // recomputed (e.g. end point of curves
@@ -5643,6 +5709,17 @@ GRegion *OCC_Internals::getRegionForOCCShape(GModel *model,
   return nullptr;
 }
 
+void OCC_Internals::_clearMaps()
+{
+  _somap.Clear();
+  _shmap.Clear();
+  _fmap.Clear();
+  _wmap.Clear();
+  _emap.Clear();
+  _vmap.Clear();
+  _mapsUpToDate = false;
+}
+
 void OCC_Internals::_addShapeToMaps(const TopoDS_Shape &shape)
 {
   // Solids
@@ -5811,12 +5888,7 @@ void OCC_Internals::_healShape(TopoDS_Shape &myshape, double tolerance,
   Msg::Info("Healing shapes (tolerance: %g)", tolerance);
   double t1 = Cpu(), w1 = TimeOfDay();
 
-  _somap.Clear();
-  _shmap.Clear();
-  _fmap.Clear();
-  _wmap.Clear();
-  _emap.Clear();
-  _vmap.Clear();
+  _clearMaps();
   _addShapeToMaps(myshape);
 
   TopExp_Explorer exp0, exp1;
@@ -6072,12 +6144,7 @@ void OCC_Internals::_healShape(TopoDS_Shape &myshape, double tolerance,
     newsurfacecont += system.Mass();
   }
 
-  _somap.Clear();
-  _shmap.Clear();
-  _fmap.Clear();
-  _wmap.Clear();
-  _emap.Clear();
-  _vmap.Clear();
+  _clearMaps();
   _addShapeToMaps(myshape);
   int nnrc = 0, nnrcs = 0;
   int nnrso = _somap.Extent(), nnrsh = _shmap.Extent(), nnrf = _fmap.Extent();
@@ -6109,12 +6176,7 @@ bool OCC_Internals::healShapes(
   b.MakeCompound(c);
 
   // construct a compound with all the shapes with tags
-  _somap.Clear();
-  _shmap.Clear();
-  _fmap.Clear();
-  _wmap.Clear();
-  _emap.Clear();
-  _vmap.Clear();
+  _clearMaps();
   TopTools_DataMapIteratorOfDataMapOfIntegerShape exp0(_tagVertex);
   for(; exp0.More(); exp0.Next()) _addShapeToMaps(exp0.Value());
   TopTools_DataMapIteratorOfDataMapOfIntegerShape exp1(_tagEdge);
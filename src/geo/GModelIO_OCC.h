@@ -49,6 +49,12 @@ private:
   // into a GModel
   TopTools_IndexedMapOfShape _vmap, _emap, _wmap, _fmap, _shmap, _somap;
 
+  // do the maps above contain all the bound shapes, except the ones in
+  // _toSync, i.e. those bound since the last synchronization? (if so, the next
+  // synchronization only needs to add these new shapes to the maps)
+  bool _mapsUpToDate;
+  std::vector<TopoDS_Shape> _toSync[4];
+
   // cache mapping TopoDS_Shapes to their corresponding (future) GEntity tags
   TopTools_DataMapOfShapeInteger _vertexTag, _edgeTag, _faceTag, _solidTag;
   TopTools_DataMapOfIntegerShape _tagVertex, _tagEdge, _tagFace, _tagSolid;
@@ -125,6 +131,9 @@ private:
   // add a shape and all its subshapes to _vmap, _emap, ..., _somap
   void _addShapeToMaps(const TopoDS_Shape &shape);
 
+  // clear _vmap, _emap, ..., _somap
+  void _clearMaps();
+
   // apply various healing algorithms to try to fix the shape
   void _healShape(TopoDS_Shape &myshape, double tolerance, bool fixDegenerated,
                   bool fixSmallEdges, bool fixSmallFaces, bool sewFaces,
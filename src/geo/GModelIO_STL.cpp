@@ -4,8 +4,12 @@
 // Please report all issues on https://gitlab.onelab.info/gmsh/gmsh/issues.
 
 #include <stdio.h>
+#include <string.h>
 #include <ctype.h>
+#include <math.h>
 #include <string>
+#include <array>
+#include <unordered_set>
 #include <algorithm>
 #include <sstream>
 #include "GModel.h"
@@ -13,13 +17,28 @@
 #include "MLine.h"
 #include "MTriangle.h"
 #include "MQuadrangle.h"
-#include "MVertexRTree.h"
 #include "discreteFace.h"
 #include "StringUtils.h"
 #include "Context.h"
 
 static bool invalidChar(char c) { return !(c >= 32 && c <= 126); }
 
+// number of facets read and decoded together in binary STL files
+static const std::size_t stlChunkSize = 65536;
+
+static std::size_t stlCellHash(long long i, long long j, long long k)
+{
+  return ((std::size_t)i * 73856093) ^ ((std::size_t)j * 19349663) ^
+         ((std::size_t)k * 83492791);
+}
+
+struct stlTriangleHash {
+  std::size_t operator()(const std::array<int, 3> &t) const
+  {
+    return stlCellHash(t[0], t[1], t[2]);
+  }
+};
+
 static char *fgets0(char *buffer, int size, FILE *fp)
 {
   // same as fgets but ignores empty lines
@@ -117,6 +136,8 @@ int GModel::readSTL(const std::string &name, double tolerance)
     else
       Msg::Info("Wrong ASCII header or empty file: trying binary read");
     rewind(fp);
+    int nthreads = CTX::instance()->numThreads;
+    if(!nthreads) nthreads = Msg::GetMaxThreads();
     while(!feof(fp)) {
       char header[80];
       if(!fread(header, sizeof(char), 80, fp)) break;
@@ -132,21 +153,28 @@ int GModel::readSTL(const std::string &name, double tolerance)
       if(ret && nfacets) {
         names.push_back(header);
         points.resize(points.size() + 1);
-        char *data = new char[nfacets * 50 * sizeof(char)];
-        ret = fread(data, sizeof(char), nfacets * 50, fp);
-        if(ret == nfacets * 50) {
-          for(std::size_t i = 0; i < nfacets; i++) {
-            float *xyz = (float *)&data[i * 50 * sizeof(char)];
+        // read the facets by chunks, which are decoded in parallel
+        std::vector<SPoint3> &pts = points.back();
+        std::vector<char> data(stlChunkSize * 50);
+        for(std::size_t first = 0; first < nfacets; first += stlChunkSize) {
+          int n = (int)std::min(stlChunkSize, (std::size_t)nfacets - first);
+          if(fread(&data[0], sizeof(char), n * 50, fp) != (std::size_t)n * 50) {
+            pts.clear();
+            break;
+          }
+          std::size_t n0 = pts.size();
+          pts.resize(n0 + 3 * n);
+#pragma omp parallel for num_threads(nthreads)
+          for(int i = 0; i < n; i++) {
+            float xyz[12];
+            memcpy(xyz, &data[i * 50], 12 * sizeof(float));
             if(swap) SwapBytes((char *)xyz, sizeof(float), 12);
-            for(int j = 0; j < 3; j++) {
-              SPoint3 p(xyz[3 + 3 * j], xyz[3 + 3 * j + 1], xyz[3 + 3 * j + 2]);
-              // p -= p0;
-              points.back().push_back(p);
-              bbox += p;
-            }
+            for(int j = 0; j < 3; j++)
+              pts[n0 + 3 * i + j] =
+                SPoint3(xyz[3 + 3 * j], xyz[3 + 3 * j + 1], xyz[3 + 3 * j + 2]);
           }
+          for(std::size_t i = n0; i < pts.size(); i++) bbox += pts[i];
         }
-        delete[] data;
       }
     }
   }
@@ -184,52 +212,100 @@ int GModel::readSTL(const std::string &name, double tolerance)
     if(!names[i].empty()) setElementaryName(2, face->tag(), names[i]);
   }
 
-  // create triangles using unique vertices
+  // weld the nodes: each point is merged with the first previous node closer
+  // than eps in each direction, which is searched for in the cells of a
+  // spatial hash grid overlapping the box of size eps around the point; only
+  // the unique nodes are stored
   double eps = norm(SVector3(bbox.max(), bbox.min())) * tolerance;
-  std::vector<MVertex *> vertices;
-  for(std::size_t i = 0; i < points.size(); i++)
-    for(std::size_t j = 0; j < points[i].size(); j++)
-      vertices.push_back(
-        new MVertex(points[i][j].x(), points[i][j].y(), points[i][j].z()));
-  MVertexRTree pos(eps);
-  pos.insert(vertices);
-
-  std::set<MFace, MFaceLessThan> unique;
-  int nbDuplic = 0, nbDegen = 0;
+  double h = std::max(2. * eps, 1e-12 * norm(SVector3(bbox.max(), bbox.min())));
+  if(h <= 0.) h = 1.;
+  std::size_t numPoints = 0;
+  for(std::size_t i = 0; i < points.size(); i++) numPoints += points[i].size();
+  std::size_t numBuckets = 1024;
+  while(numBuckets < numPoints / 4) numBuckets *= 2;
+  std::vector<int> heads(numBuckets, -1), next, index(numPoints);
+  std::vector<double> xyz;
+  std::size_t ip = 0;
   for(std::size_t i = 0; i < points.size(); i++) {
-    for(std::size_t j = 0; j < points[i].size(); j += 3) {
-      MVertex *v[3];
-      for(int k = 0; k < 3; k++) {
-        double x = points[i][j + k].x();
-        double y = points[i][j + k].y();
-        double z = points[i][j + k].z();
-        v[k] = pos.find(x, y, z);
-        if(!v[k])
-          Msg::Error("Could not find node at position (%.16g, %.16g, %.16g) "
-                     "with tol=%.16g",
-                     x, y, z, eps);
+    for(std::size_t j = 0; j < points[i].size(); j++, ip++) {
+      const SPoint3 &p = points[i][j];
+      long long c0[3], c1[3];
+      for(int d = 0; d < 3; d++) {
+        c0[d] = (long long)std::floor((p[d] - eps - bbox.min()[d]) / h);
+        c1[d] = (long long)std::floor((p[d] + eps - bbox.min()[d]) / h);
       }
-      if(!v[0] || !v[1] || !v[2]) {
-        // error
+      int found = -1;
+      for(long long cx = c0[0]; cx <= c1[0] && found < 0; cx++) {
+        for(long long cy = c0[1]; cy <= c1[1] && found < 0; cy++) {
+          for(long long cz = c0[2]; cz <= c1[2] && found < 0; cz++) {
+            int n = heads[stlCellHash(cx, cy, cz) & (numBuckets - 1)];
+            for(; n >= 0; n = next[n]) {
+              if(std::abs(xyz[3 * n] - p.x()) <= eps &&
+                 std::abs(xyz[3 * n + 1] - p.y()) <= eps &&
+                 std::abs(xyz[3 * n + 2] - p.z()) <= eps) {
+                found = n;
+                break;
+              }
+            }
+          }
+        }
       }
-      else if(v[0] == v[1] || v[0] == v[2] || v[1] == v[2]) {
+      if(found < 0) {
+        found = (int)next.size();
+        std::size_t b =
+          stlCellHash((long long)std::floor((p.x() - bbox.min().x()) / h),
+                      (long long)std::floor((p.y() - bbox.min().y()) / h),
+                      (long long)std::floor((p.z() - bbox.min().z()) / h)) &
+          (numBuckets - 1);
+        next.push_back(heads[b]);
+        heads[b] = found;
+        xyz.push_back(p.x());
+        xyz.push_back(p.y());
+        xyz.push_back(p.z());
+      }
+      index[ip] = found;
+    }
+  }
+  std::vector<int>().swap(heads);
+  std::vector<int>().swap(next);
+
+  std::vector<std::size_t> numTriangles(points.size());
+  for(std::size_t i = 0; i < points.size(); i++) {
+    numTriangles[i] = points[i].size() / 3;
+    std::vector<SPoint3>().swap(points[i]);
+  }
+
+  // create the triangles, detecting duplicates with a hash set of their
+  // sorted node indices
+  std::vector<MVertex *> vertices(xyz.size() / 3);
+  for(std::size_t i = 0; i < vertices.size(); i++)
+    vertices[i] = new MVertex(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]);
+  std::vector<double>().swap(xyz);
+
+  std::unordered_set<std::array<int, 3>, stlTriangleHash> unique;
+  if(CTX::instance()->mesh.stlRemoveDuplicateTriangles)
+    unique.reserve(numPoints / 3);
+  int nbDuplic = 0, nbDegen = 0;
+  ip = 0;
+  for(std::size_t i = 0; i < numTriangles.size(); i++) {
+    faces[i]->triangles.reserve(numTriangles[i]);
+    for(std::size_t j = 0; j < numTriangles[i]; j++, ip += 3) {
+      std::array<int, 3> t = {index[ip], index[ip + 1], index[ip + 2]};
+      MVertex *v[3] = {vertices[t[0]], vertices[t[1]], vertices[t[2]]};
+      if(t[0] == t[1] || t[0] == t[2] || t[1] == t[2]) {
         Msg::Debug("Skipping degenerated triangle %lu %lu %lu", v[0]->getNum(),
                    v[1]->getNum(), v[2]->getNum());
         nbDegen++;
+        continue;
       }
-      else if(CTX::instance()->mesh.stlRemoveDuplicateTriangles) {
-        MFace mf(v[0], v[1], v[2]);
-        if(unique.find(mf) == unique.end()) {
-          faces[i]->triangles.push_back(new MTriangle(v[0], v[1], v[2]));
-          unique.insert(mf);
-        }
-        else {
+      if(CTX::instance()->mesh.stlRemoveDuplicateTriangles) {
+        std::sort(t.begin(), t.end());
+        if(!unique.insert(t).second) {
           nbDuplic++;
+          continue;
         }
       }
-      else {
-        faces[i]->triangles.push_back(new MTriangle(v[0], v[1], v[2]));
-      }
+      faces[i]->triangles.push_back(new MTriangle(v[0], v[1], v[2]));
     }
   }
   if(nbDuplic || nbDegen)
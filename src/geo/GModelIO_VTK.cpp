@@ -3,8 +3,19 @@
 // See the LICENSE.txt file in the Gmsh root directory for license information.
 // Please report all issues on https://gitlab.onelab.info/gmsh/gmsh/issues.
 
+#include <stdio.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <stdexcept>
 #include "GModel.h"
 #include "OS.h"
+#include "Context.h"
+#include "partitionRegion.h"
+#include "partitionFace.h"
+#include "partitionEdge.h"
+#include "partitionVertex.h"
 #include "MPoint.h"
 #include "MLine.h"
 #include "MTriangle.h"
@@ -232,6 +243,328 @@ int GModel::writeVTKSteam(std::ostream &os, bool binary, bool saveAll,
   return 1;
 }
 
+// number of values encoded together when writing ASCII VTU data arrays
+static const std::size_t vtuChunkSize = 65536;
+
+static int vtuFormat(char *buf, double v) { return sprintf(buf, "%.16g", v); }
+static int vtuFormat(char *buf, long long v) { return sprintf(buf, "%lld", v); }
+static int vtuFormat(char *buf, int v) { return sprintf(buf, "%d", v); }
+static int vtuFormat(char *buf, unsigned char v)
+{
+  return sprintf(buf, "%d", (int)v);
+}
+
+template <class T>
+static void writeVTUAscii(FILE *fp, const std::vector<T> &data, int numComp,
+                          int nthreads)
+{
+  // the values are encoded by chunks in parallel; the text of each batch of
+  // chunks is then written sequentially
+  std::size_t numChunks = (data.size() + vtuChunkSize - 1) / vtuChunkSize;
+  std::size_t batch = 4 * nthreads;
+  std::vector<std::string> text(batch);
+  for(std::size_t first = 0; first < numChunks; first += batch) {
+    int n = (int)std::min(batch, numChunks - first);
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+    for(int c = 0; c < n; c++) {
+      std::size_t i0 = (first + c) * vtuChunkSize;
+      std::size_t i1 = std::min(i0 + vtuChunkSize, data.size());
+      std::string &s = text[c];
+      s.clear();
+      char buf[64];
+      for(std::size_t i = i0; i < i1; i++) {
+        int l = vtuFormat(buf, data[i]);
+        buf[l++] = ((i + 1) % numComp) ? ' ' : '\n';
+        s.append(buf, l);
+      }
+    }
+    for(int c = 0; c < n; c++) fwrite(text[c].data(), 1, text[c].size(), fp);
+  }
+}
+
+template <class T>
+static void writeVTUDataArray(FILE *fp, const char *type, const char *name,
+                              int numComp, const std::vector<T> &data,
+                              bool binary, std::size_t &offset, int nthreads)
+{
+  fprintf(fp, "        <DataArray type=\"%s\"", type);
+  if(name) fprintf(fp, " Name=\"%s\"", name);
+  if(numComp > 1) fprintf(fp, " NumberOfComponents=\"%d\"", numComp);
+  if(binary) {
+    // the data is written in the appended section, prefixed by its size
+    fprintf(fp, " format=\"appended\" offset=\"%lu\"/>\n", offset);
+    offset += sizeof(unsigned long long) + data.size() * sizeof(T);
+  }
+  else {
+    fprintf(fp, " format=\"ascii\">\n");
+    writeVTUAscii(fp, data, numComp, nthreads);
+    fprintf(fp, "        </DataArray>\n");
+  }
+}
+
+template <class T>
+static void writeVTUAppendedData(FILE *fp, const std::vector<T> &data)
+{
+  unsigned long long size = data.size() * sizeof(T);
+  fwrite(&size, sizeof(unsigned long long), 1, fp);
+  if(data.size()) fwrite(&data[0], sizeof(T), data.size(), fp);
+}
+
+static bool writeVTUPiece(const std::string &name,
+                          const std::vector<GEntity *> &entities, bool binary,
+                          double scalingFactor, bool bigEndian, int nthreads)
+{
+  // elements to save, with the first physical group of their entity
+  std::vector<MElement *> elements;
+  std::vector<int> cellEntityIds;
+  for(std::size_t i = 0; i < entities.size(); i++) {
+    int phys = entities[i]->physicals.size() ? entities[i]->physicals[0] : -1;
+    for(std::size_t j = 0; j < entities[i]->getNumMeshElements(); j++) {
+      MElement *e = entities[i]->getMeshElement(j);
+      if(e->getTypeForVTK()) {
+        elements.push_back(e);
+        cellEntityIds.push_back(phys);
+      }
+    }
+  }
+
+  std::vector<long long> offsets(elements.size());
+  std::vector<unsigned char> types(elements.size());
+  long long numConn = 0;
+  std::size_t maxNum = 0;
+  for(std::size_t i = 0; i < elements.size(); i++) {
+    MElement *e = elements[i];
+    std::size_t n = e->getNumVertices();
+    for(std::size_t k = 0; k < n; k++)
+      maxNum = std::max(maxNum, e->getVertex(k)->getNum());
+    numConn += n;
+    offsets[i] = numConn;
+    types[i] = (unsigned char)e->getTypeForVTK();
+  }
+
+  // number the nodes of the piece by increasing tag (without touching the node
+  // indices, so that several pieces can be written concurrently): with a dense
+  // array indexed by tag if the tags of the piece are not too sparse, or by
+  // sorting the nodes otherwise, so that the memory used is proportional to
+  // the size of the piece
+  const bool dense = maxNum <= 4 * (std::size_t)numConn;
+  std::vector<MVertex *> vertices;
+  std::vector<long long> localIndex;
+  if(dense) {
+    localIndex.resize(maxNum + 1, -1);
+    for(std::size_t i = 0; i < elements.size(); i++) {
+      MElement *e = elements[i];
+      for(std::size_t k = 0; k < e->getNumVertices(); k++)
+        localIndex[e->getVertex(k)->getNum()] = 0;
+    }
+    for(std::size_t i = 0; i < elements.size(); i++) {
+      MElement *e = elements[i];
+      for(std::size_t k = 0; k < e->getNumVertices(); k++) {
+        MVertex *v = e->getVertex(k);
+        if(!localIndex[v->getNum()]) {
+          localIndex[v->getNum()] = 1;
+          vertices.push_back(v);
+        }
+      }
+    }
+  }
+  else {
+    vertices.reserve(numConn);
+    for(std::size_t i = 0; i < elements.size(); i++) {
+      MElement *e = elements[i];
+      for(std::size_t k = 0; k < e->getNumVertices(); k++)
+        vertices.push_back(e->getVertex(k));
+    }
+  }
+  std::sort(vertices.begin(), vertices.end(), MVertexPtrLessThan());
+  vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                 vertices.end());
+  if(dense) {
+    for(std::size_t i = 0; i < vertices.size(); i++)
+      localIndex[vertices[i]->getNum()] = i;
+  }
+
+  std::vector<long long> connectivity(numConn);
+#pragma omp parallel for schedule(dynamic, 1024) num_threads(nthreads)
+  for(int i = 0; i < (int)elements.size(); i++) {
+    MElement *e = elements[i];
+    long long o = i ? offsets[i - 1] : 0;
+    for(std::size_t k = 0; k < e->getNumVertices(); k++) {
+      MVertex *v = e->getVertexVTK(k);
+      if(dense)
+        connectivity[o + k] = localIndex[v->getNum()];
+      else
+        connectivity[o + k] =
+          std::lower_bound(vertices.begin(), vertices.end(), v,
+                           MVertexPtrLessThan()) -
+          vertices.begin();
+    }
+  }
+  std::vector<long long>().swap(localIndex);
+
+  std::vector<double> points(3 * vertices.size());
+#pragma omp parallel for num_threads(nthreads)
+  for(int i = 0; i < (int)vertices.size(); i++) {
+    points[3 * i] = vertices[i]->x() * scalingFactor;
+    points[3 * i + 1] = vertices[i]->y() * scalingFactor;
+    points[3 * i + 2] = vertices[i]->z() * scalingFactor;
+  }
+
+  FILE *fp = Fopen(name.c_str(), binary ? "wb" : "w");
+  if(!fp) {
+    Msg::Error("Unable to open file '%s'", name.c_str());
+    return false;
+  }
+
+  fprintf(fp, "<?xml version=\"1.0\"?>\n");
+  fprintf(fp,
+          "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+          "byte_order=\"%s\" header_type=\"UInt64\">\n",
+          bigEndian ? "BigEndian" : "LittleEndian");
+  fprintf(fp, "  <UnstructuredGrid>\n");
+  fprintf(fp, "    <Piece NumberOfPoints=\"%lu\" NumberOfCells=\"%lu\">\n",
+          vertices.size(), elements.size());
+  std::size_t offset = 0;
+  fprintf(fp, "      <Points>\n");
+  writeVTUDataArray(fp, "Float64", nullptr, 3, points, binary, offset,
+                    nthreads);
+  fprintf(fp, "      </Points>\n");
+  fprintf(fp, "      <Cells>\n");
+  writeVTUDataArray(fp, "Int64", "connectivity", 1, connectivity, binary,
+                    offset, nthreads);
+  writeVTUDataArray(fp, "Int64", "offsets", 1, offsets, binary, offset,
+                    nthreads);
+  writeVTUDataArray(fp, "UInt8", "types", 1, types, binary, offset, nthreads);
+  fprintf(fp, "      </Cells>\n");
+  fprintf(fp, "      <CellData Scalars=\"CellEntityIds\">\n");
+  writeVTUDataArray(fp, "Int32", "CellEntityIds", 1, cellEntityIds, binary,
+                    offset, nthreads);
+  fprintf(fp, "      </CellData>\n");
+  fprintf(fp, "    </Piece>\n");
+  fprintf(fp, "  </UnstructuredGrid>\n");
+  if(binary) {
+    fprintf(fp, "  <AppendedData encoding=\"raw\">\n_");
+    writeVTUAppendedData(fp, points);
+    writeVTUAppendedData(fp, connectivity);
+    writeVTUAppendedData(fp, offsets);
+    writeVTUAppendedData(fp, types);
+    writeVTUAppendedData(fp, cellEntityIds);
+    fprintf(fp, "\n  </AppendedData>\n");
+  }
+  fprintf(fp, "</VTKFile>\n");
+
+  fclose(fp);
+  return true;
+}
+
+int GModel::writeVTU(const std::string &name, bool binary, bool saveAll,
+                     double scalingFactor, bool bigEndian)
+{
+  if(noPhysicalGroups()) saveAll = true;
+
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+
+  std::vector<GEntity *> entities, toSave;
+  getEntities(entities);
+  for(std::size_t i = 0; i < entities.size(); i++) {
+    if(entities[i]->physicals.size() || saveAll)
+      toSave.push_back(entities[i]);
+  }
+
+  return writeVTUPiece(name, toSave, binary, scalingFactor, bigEndian,
+                       nthreads) ?
+           1 :
+           0;
+}
+
+int GModel::writePartitionedVTU(const std::string &baseName, bool binary,
+                                bool saveAll, double scalingFactor,
+                                bool bigEndian)
+{
+  if(noPhysicalGroups()) saveAll = true;
+
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+
+  // entities of each partition
+  std::vector<GEntity *> entities;
+  getEntities(entities);
+  std::vector<std::vector<GEntity *> > parts(getNumPartitions());
+  for(std::size_t i = 0; i < entities.size(); i++) {
+    GEntity *ge = entities[i];
+    if(!ge->physicals.size() && !saveAll) continue;
+    const std::vector<int> *p = nullptr;
+    switch(ge->geomType()) {
+    case GEntity::PartitionPoint:
+      p = &static_cast<partitionVertex *>(ge)->getPartitions();
+      break;
+    case GEntity::PartitionCurve:
+      p = &static_cast<partitionEdge *>(ge)->getPartitions();
+      break;
+    case GEntity::PartitionSurface:
+      p = &static_cast<partitionFace *>(ge)->getPartitions();
+      break;
+    case GEntity::PartitionVolume:
+      p = &static_cast<partitionRegion *>(ge)->getPartitions();
+      break;
+    default: break;
+    }
+    if(!p) continue;
+    for(std::size_t j = 0; j < p->size(); j++) {
+      if((*p)[j] >= 1 && (*p)[j] <= (int)parts.size())
+        parts[(*p)[j] - 1].push_back(ge);
+    }
+  }
+
+  // the pieces are written concurrently, each one with a single thread
+  std::string fileName = SplitFileName(baseName)[1];
+  bool exceptions = false;
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+  for(int part = 1; part <= (int)parts.size(); part++) {
+    if(exceptions) continue;
+    std::ostringstream sstream;
+    sstream << baseName << "_" << part << ".vtu";
+    Msg::Info("Writing partition %d in file '%s'", part,
+              sstream.str().c_str());
+    try { // OpenMP forbids leaving block via exception
+      writeVTUPiece(sstream.str(), parts[part - 1], binary, scalingFactor,
+                    bigEndian, 1);
+    }
+    catch(...) {
+      exceptions = true;
+    }
+  }
+
+  if(exceptions) throw std::runtime_error(Msg::GetLastError());
+
+  std::string name = baseName + ".pvtu";
+  FILE *fp = Fopen(name.c_str(), "w");
+  if(!fp) {
+    Msg::Error("Unable to open file '%s'", name.c_str());
+    return 0;
+  }
+  fprintf(fp, "<?xml version=\"1.0\"?>\n");
+  fprintf(fp,
+          "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" "
+          "byte_order=\"%s\" header_type=\"UInt64\">\n",
+          bigEndian ? "BigEndian" : "LittleEndian");
+  fprintf(fp, "  <PUnstructuredGrid GhostLevel=\"0\">\n");
+  fprintf(fp, "    <PPoints>\n");
+  fprintf(fp, "      <PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n");
+  fprintf(fp, "    </PPoints>\n");
+  fprintf(fp, "    <PCellData Scalars=\"CellEntityIds\">\n");
+  fprintf(fp, "      <PDataArray type=\"Int32\" Name=\"CellEntityIds\"/>\n");
+  fprintf(fp, "    </PCellData>\n");
+  for(std::size_t part = 1; part <= parts.size(); part++)
+    fprintf(fp, "    <Piece Source=\"%s_%lu.vtu\"/>\n", fileName.c_str(),
+            part);
+  fprintf(fp, "  </PUnstructuredGrid>\n");
+  fprintf(fp, "</VTKFile>\n");
+  fclose(fp);
+  return 1;
+}
+
 int GModel::readVTK(const std::string &name, bool bigEndian)
 {
   FILE *fp = Fopen(name.c_str(), "rb");
@@ -8,6 +8,7 @@
 #include <map>
 #include <stack>
 #include <sstream>
+#include <stdexcept>
 #include <string.h>
 #include "GmshConfig.h"
 #include "GModel.h"
@@ -34,6 +35,7 @@
 
 #if defined(HAVE_SOLVER)
 #include "linearSystemPETSc.h"
+#include "linearSystemEigen.h"
 #include "linearSystemCSR.h"
 #include "linearSystemFull.h"
 #endif
@@ -432,11 +434,29 @@ void classifyFaces(GModel *gm, double angleThreshold, bool includeBoundary,
     }
   }
 
+  double t3 = Cpu(), w3 = TimeOfDay();
+  Msg::Info("Detected %lu feature mesh edges (Wall %gs, CPU %gs)",
+            edge->lines.size(), w3 - w1, t3 - t1);
+
   computeDiscreteCurvatures(gm);
-  if(forParametrization)
+  double t4 = Cpu(), w4 = TimeOfDay();
+  Msg::Info("Computed discrete curvatures (Wall %gs, CPU %gs)", w4 - w3,
+            t4 - t3);
+
+  if(forParametrization) {
     computeEdgeCut(gm, edge->lines, CTX::instance()->mesh.reparamMaxTriangles);
+    double t5 = Cpu(), w5 = TimeOfDay();
+    Msg::Info("Split triangulations for parametrization (Wall %gs, CPU %gs)",
+              w5 - w4, t5 - t4);
+    t4 = t5;
+    w4 = w5;
+  }
+
   computeNonManifoldEdges(gm, edge->lines, true);
   classifyFaces(gm, curveAngleThreshold);
+  double t6 = Cpu(), w6 = TimeOfDay();
+  Msg::Info("Created classified surfaces and curves (Wall %gs, CPU %gs)",
+            w6 - w4, t6 - t4);
 
   gm->remove(edge);
   edge->lines.clear();
@@ -463,31 +483,47 @@ int computeDiscreteCurvatures(GModel *gm)
 {
   std::map<MVertex *, std::pair<SVector3, SVector3> > &C = gm->getCurvatures();
   C.clear();
-  for(auto it = gm->firstFace(); it != gm->lastFace(); ++it) {
-    GFace *gf = *it;
+
+  // the curvatures of each surface are computed independently, in parallel;
+  // they are then merged in the order of the surfaces (for nodes shared by
+  // several surfaces, the value of the last surface is kept)
+  std::vector<GFace *> faces(gm->firstFace(), gm->lastFace());
+  std::vector<std::vector<MVertex *> > faceNodes(faces.size());
+  std::vector<std::vector<std::pair<SVector3, SVector3> > > faceCurv(
+    faces.size());
+
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+  for(int k = 0; k < (int)faces.size(); k++) {
+    GFace *gf = faces[k];
     std::map<MVertex *, int> nodeIndex;
     std::vector<SPoint3> nodes;
     std::vector<int> tris;
-    std::vector<std::pair<SVector3, SVector3> > curv;
     for(std::size_t i = 0; i < gf->triangles.size(); i++) {
       MTriangle *t = gf->triangles[i];
       for(int j = 0; j < 3; j++) {
         MVertex *v = t->getVertex(j);
-        if(nodeIndex.find(v) == nodeIndex.end()) {
+        auto it = nodeIndex.find(v);
+        if(it == nodeIndex.end()) {
           int idx = nodes.size();
           nodeIndex[v] = idx;
           nodes.push_back(v->point());
           tris.push_back(idx);
+          faceNodes[k].push_back(v);
         }
         else {
-          tris.push_back(nodeIndex[v]);
+          tris.push_back(it->second);
         }
       }
     }
-    CurvatureRusinkiewicz(tris, nodes, curv);
-    for(auto itv = nodeIndex.begin(); itv != nodeIndex.end(); itv++) {
-      C[itv->first] = curv[itv->second];
-    }
+    if(tris.empty()) continue;
+    CurvatureRusinkiewicz(tris, nodes, faceCurv[k]);
+  }
+
+  for(std::size_t k = 0; k < faces.size(); k++) {
+    for(std::size_t i = 0; i < faceNodes[k].size(); i++)
+      C[faceNodes[k][i]] = faceCurv[k][i];
   }
   return 0;
 }
@@ -612,6 +648,10 @@ bool computeParametrization(const std::vector<MTriangle *> &triangles,
 #endif
   lsys->setParameter("petsc_solver_options", options);
   lsys->setParameter("matrix_reuse", "same_matrix");
+#elif defined(HAVE_EIGEN)
+  // direct solver: the LU factorization is computed once and reused for the u
+  // and v right-hand sides
+  linearSystemEigen<double> *lsys = new linearSystemEigen<double>;
 #elif defined(HAVE_GMM)
   linearSystemCSRGmm<double> *lsys = new linearSystemCSRGmm<double>;
 #else
@@ -620,7 +660,7 @@ bool computeParametrization(const std::vector<MTriangle *> &triangles,
 
   lsys->allocate(nodes.size());
 
-#if defined(HAVE_PETSC)
+#if defined(HAVE_PETSC) || defined(HAVE_EIGEN)
   for(auto it = edges.begin(); it != edges.end(); ++it) {
     for(int i = 0; i < 2; i++) {
       for(int j = 0; j < 2; j++) {
@@ -849,99 +889,129 @@ makePartitionSimplyConnected(std::vector<MTriangle *> &t,
   return true;
 }
 
-void computeEdgeCut(GModel *gm, std::vector<MLine *> &cut,
-                    int max_elems_per_cut)
+static void computeEdgeCut(GFace *gf, std::vector<MLine *> &cut,
+                           int max_elems_per_cut)
 {
-  Msg::Info("Splitting triangulations to make them parametrizable:");
-
-  for(auto it = gm->firstFace(); it != gm->lastFace(); ++it) {
-    int part = 0;
-    if((*it)->triangles.empty()) continue;
-    std::vector<MVertex *> verts = (*it)->mesh_vertices;
-    std::map<MTriangle *, int, MElementPtrLessThan> global;
-    std::map<MEdge, int, MEdgeLessThan> cuts;
-    std::stack<std::vector<MTriangle *> > partitions;
-    std::stack<int> _levels;
-    partitions.push((*it)->triangles);
-    _levels.push(0);
-    (*it)->triangles.clear();
-
-    while(!partitions.empty()) {
-      int level = _levels.top();
-      _levels.pop();
-      (*it)->triangles = partitions.top();
-      (*it)->mesh_vertices.clear();
-      std::set<MVertex *, MVertexPtrLessThan> vs;
-      for(std::size_t i = 0; i < (*it)->triangles.size(); ++i) {
-        for(std::size_t j = 0; j < 3; ++j)
-          vs.insert((*it)->triangles[i]->getVertex(j));
-      }
-      (*it)->mesh_vertices.insert((*it)->mesh_vertices.begin(), vs.begin(),
-                                  vs.end());
-      partitions.pop();
-      std::ostringstream why;
-      int np =
-        isTriangulationParametrizable((*it)->triangles, max_elems_per_cut, why);
-      if(np > 1) {
-        Msg::Info(" - Level %d partition with %d triangles split in %d "
-                  "parts because %s",
-                  level, (*it)->triangles.size(), np, why.str().c_str());
-      }
-      else if(np < 0) {
-        Msg::Error("Could not create parametrization (check orientation of "
-                   "input triangulations)");
-        break;
-      }
-      if(np == 1) {
-        for(std::size_t i = 0; i < (*it)->triangles.size(); i++)
-          global[(*it)->triangles[i]] = part;
-        part++;
-      }
-      else {
+  int part = 0;
+  if(gf->triangles.empty()) return;
+  std::vector<MVertex *> verts = gf->mesh_vertices;
+  std::map<MTriangle *, int, MElementPtrLessThan> global;
+  std::map<MEdge, int, MEdgeLessThan> cuts;
+  std::stack<std::vector<MTriangle *> > partitions;
+  std::stack<int> _levels;
+  partitions.push(gf->triangles);
+  _levels.push(0);
+  gf->triangles.clear();
+
+  while(!partitions.empty()) {
+    int level = _levels.top();
+    _levels.pop();
+    gf->triangles = partitions.top();
+    gf->mesh_vertices.clear();
+    std::set<MVertex *, MVertexPtrLessThan> vs;
+    for(std::size_t i = 0; i < gf->triangles.size(); ++i) {
+      for(std::size_t j = 0; j < 3; ++j)
+        vs.insert(gf->triangles[i]->getVertex(j));
+    }
+    gf->mesh_vertices.insert(gf->mesh_vertices.begin(), vs.begin(), vs.end());
+    partitions.pop();
+    std::ostringstream why;
+    int np =
+      isTriangulationParametrizable(gf->triangles, max_elems_per_cut, why);
+    if(np > 1) {
+      Msg::Info(" - Surface %d: level %d partition with %d triangles split "
+                "in %d parts because %s",
+                gf->tag(), level, gf->triangles.size(), np, why.str().c_str());
+    }
+    else if(np < 0) {
+      Msg::Error("Could not create parametrization (check orientation of "
+                 "input triangulations)");
+      break;
+    }
+    if(np == 1) {
+      for(std::size_t i = 0; i < gf->triangles.size(); i++)
+        global[gf->triangles[i]] = part;
+      part++;
+    }
+    else {
 #if defined(HAVE_MESH)
-        if(!PartitionFaceMinEdgeLength(*it, np)) {
-          std::vector<std::vector<MTriangle *> > t(np);
-          for(std::size_t i = 0; i < (*it)->triangles.size(); i++) {
-            int p = (*it)->triangles[i]->getPartition();
-            if(p >= 0 && p < np)
-              t[p].push_back((*it)->triangles[i]);
-            else
-              Msg::Error("Invalid partition index");
+      if(!PartitionFaceMinEdgeLength(gf, np)) {
+        std::vector<std::vector<MTriangle *> > t(np);
+        for(std::size_t i = 0; i < gf->triangles.size(); i++) {
+          int p = gf->triangles[i]->getPartition();
+          if(p >= 0 && p < np)
+            t[p].push_back(gf->triangles[i]);
+          else
+            Msg::Error("Invalid partition index");
+        }
+        for(std::size_t i = 0; i < t.size(); i++) {
+          std::vector<std::vector<MTriangle *> > ts;
+          if(!makePartitionSimplyConnected(t[i], ts)) {
+            Msg::Warning("Could not make partition simply connected");
+            break;
           }
-          for(std::size_t i = 0; i < t.size(); i++) {
-            std::vector<std::vector<MTriangle *> > ts;
-            if(!makePartitionSimplyConnected(t[i], ts)) {
-              Msg::Warning("Could not make partition simply connected");
-              break;
-            }
-            for(std::size_t j = 0; j < ts.size(); j++) {
-              _levels.push(level + 1);
-              partitions.push(ts[j]);
-            }
+          for(std::size_t j = 0; j < ts.size(); j++) {
+            _levels.push(level + 1);
+            partitions.push(ts[j]);
           }
         }
+      }
 #else
-        Msg::Error("Partitioning surface requires Mesh module");
+      Msg::Error("Partitioning surface requires Mesh module");
 #endif
-      }
     }
-    (*it)->triangles.clear();
-    for(auto it2 = global.begin(); it2 != global.end(); ++it2) {
-      MTriangle *t = it2->first;
-      (*it)->triangles.push_back(t);
-      for(int i = 0; i < 3; i++) {
-        MEdge ed = t->getEdge(i);
-        auto it3 = cuts.find(ed);
-        if(it3 == cuts.end())
-          cuts[ed] = it2->second;
-        else {
-          if(it3->second != it2->second)
-            cut.push_back(new MLine(ed.getVertex(0), ed.getVertex(1)));
-        }
+  }
+  gf->triangles.clear();
+  for(auto it2 = global.begin(); it2 != global.end(); ++it2) {
+    MTriangle *t = it2->first;
+    gf->triangles.push_back(t);
+    for(int i = 0; i < 3; i++) {
+      MEdge ed = t->getEdge(i);
+      auto it3 = cuts.find(ed);
+      if(it3 == cuts.end())
+        cuts[ed] = it2->second;
+      else {
+        if(it3->second != it2->second)
+          cut.push_back(new MLine(ed.getVertex(0), ed.getVertex(1)));
       }
     }
-    (*it)->mesh_vertices = verts;
   }
+  gf->mesh_vertices = verts;
+}
+
+void computeEdgeCut(GModel *gm, std::vector<MLine *> &cut,
+                    int max_elems_per_cut)
+{
+  Msg::Info("Splitting triangulations to make them parametrizable:");
+
+  // each surface is split independently (with its own parametrization tests
+  // and linear systems), so that surfaces can be processed in parallel -
+  // except with PETSc, which is not thread-safe; the cuts are then merged in
+  // the order of the surfaces
+  std::vector<GFace *> faces(gm->firstFace(), gm->lastFace());
+  std::vector<std::vector<MLine *> > faceCuts(faces.size());
+
+#if defined(HAVE_PETSC)
+  int nthreads = 1;
+#else
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+#endif
+  bool exceptions = false;
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+  for(int i = 0; i < (int)faces.size(); i++) {
+    if(exceptions) continue;
+    try { // OpenMP forbids leaving block via exception
+      computeEdgeCut(faces[i], faceCuts[i], max_elems_per_cut);
+    }
+    catch(...) {
+      exceptions = true;
+    }
+  }
+
+  for(std::size_t i = 0; i < faceCuts.size(); i++)
+    cut.insert(cut.end(), faceCuts[i].begin(), faceCuts[i].end());
+  if(exceptions) throw std::runtime_error(Msg::GetLastError());
   makeMLinesUnique(cut);
 }
 
@@ -190,79 +190,128 @@ static void addSmoothNormals(GEntity *e, std::vector<T *> &elements)
   }
 }
 
+static void addElementInArrays(GEntity *e, MElement *ele, bool edges,
+                               bool faces, VertexArray *va_lines,
+                               VertexArray *va_triangles)
+{
+  if(!isElementVisible(ele) || ele->getDim() < 1) return;
+
+  unsigned int c = getColorByElement(ele);
+  unsigned int col[4] = {c, c, c, c};
+
+  const bool curved =
+    (ele->getPolynomialOrder() > 1) &&
+    (ele->maxDistToStraight() > curvedRepTol * ele->getInnerRadius());
+
+  SPoint3 pc(0., 0., 0.);
+  if(CTX::instance()->mesh.explode != 1.) pc = ele->barycenter();
+
+  if(edges) {
+    bool unique = e->dim() > 1 && !CTX::instance()->pickElements;
+    for(int j = 0; j < ele->getNumEdgesRep(curved); j++) {
+      double x[2], y[2], z[2];
+      SVector3 n[2];
+      ele->getEdgeRep(curved, j, x, y, z, n);
+      if(CTX::instance()->mesh.explode != 1.) {
+        for(int k = 0; k < 2; k++) {
+          x[k] = pc[0] + CTX::instance()->mesh.explode * (x[k] - pc[0]);
+          y[k] = pc[1] + CTX::instance()->mesh.explode * (y[k] - pc[1]);
+          z[k] = pc[2] + CTX::instance()->mesh.explode * (z[k] - pc[2]);
+        }
+      }
+      if(e->dim() == 2 && CTX::instance()->mesh.smoothNormals)
+        for(int k = 0; k < 2; k++)
+          e->model()->normals->get(x[k], y[k], z[k], n[k][0], n[k][1],
+                                   n[k][2]);
+      va_lines->add(x, y, z, n, col, ele, unique);
+    }
+  }
+
+  if(faces) {
+    bool unique = e->dim() > 2 && !CTX::instance()->pickElements;
+    bool skin = e->dim() > 2 && CTX::instance()->mesh.drawSkinOnly;
+    for(int j = 0; j < ele->getNumFacesRep(curved); j++) {
+      double x[3], y[3], z[3];
+      SVector3 n[3];
+      ele->getFaceRep(curved, j, x, y, z, n);
+      if(CTX::instance()->mesh.explode != 1.) {
+        for(int k = 0; k < 3; k++) {
+          x[k] = pc[0] + CTX::instance()->mesh.explode * (x[k] - pc[0]);
+          y[k] = pc[1] + CTX::instance()->mesh.explode * (y[k] - pc[1]);
+          z[k] = pc[2] + CTX::instance()->mesh.explode * (z[k] - pc[2]);
+        }
+      }
+      if(e->dim() == 2 && CTX::instance()->mesh.smoothNormals)
+        for(int k = 0; k < 3; k++)
+          e->model()->normals->get(x[k], y[k], z[k], n[k][0], n[k][1],
+                                   n[k][2]);
+      va_triangles->add(x, y, z, n, col, ele, unique, skin);
+    }
+  }
+}
+
 template <class T>
 static void addElementsInArrays(GEntity *e, std::vector<T *> &elements,
                                 bool edges, bool faces)
 {
+  if(elements.empty()) return;
+
   int nthreads = CTX::instance()->numThreads;
   if(!nthreads) nthreads = Msg::GetMaxThreads();
-#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
-  for(std::size_t i = 0; i < elements.size(); i++) {
-    MElement *ele = elements[i];
-
-    if(!isElementVisible(ele) || ele->getDim() < 1) continue;
-
-    unsigned int c = getColorByElement(ele);
-    unsigned int col[4] = {c, c, c, c};
-
-    const bool curved =
-      (ele->getPolynomialOrder() > 1) &&
-      (ele->maxDistToStraight() > curvedRepTol * ele->getInnerRadius());
+  if(elements.size() < 1000) nthreads = 1;
 
-    SPoint3 pc(0., 0., 0.);
-    if(CTX::instance()->mesh.explode != 1.) pc = ele->barycenter();
+  if(nthreads == 1) {
+    for(std::size_t i = 0; i < elements.size(); i++)
+      addElementInArrays(e, elements[i], edges, faces, e->va_lines,
+                         e->va_triangles);
+    return;
+  }
 
-    if(edges) {
-      bool unique = e->dim() > 1 && !CTX::instance()->pickElements;
-      for(int j = 0; j < ele->getNumEdgesRep(curved); j++) {
-        double x[2], y[2], z[2];
-        SVector3 n[2];
-        ele->getEdgeRep(curved, j, x, y, z, n);
-        if(CTX::instance()->mesh.explode != 1.) {
-          for(int k = 0; k < 2; k++) {
-            x[k] = pc[0] + CTX::instance()->mesh.explode * (x[k] - pc[0]);
-            y[k] = pc[1] + CTX::instance()->mesh.explode * (y[k] - pc[1]);
-            z[k] = pc[2] + CTX::instance()->mesh.explode * (z[k] - pc[2]);
-          }
-        }
-        if(e->dim() == 2 && CTX::instance()->mesh.smoothNormals)
-          for(int k = 0; k < 2; k++)
-            e->model()->normals->get(x[k], y[k], z[k], n[k][0], n[k][1],
-                                     n[k][2]);
-#pragma omp critical
-        {
-          e->va_lines->add(x, y, z, n, col, ele, unique);
-        }
-      }
+  // each thread fills its own (pre-sized) arrays with a contiguous range of
+  // elements; the first thread writes directly in the arrays of the entity,
+  // and the others are then merged in order, without any locking
+  int numEdgesRep = edges ? elements[0]->getNumEdgesRep(false) : 0;
+  int numFacesRep = faces ? elements[0]->getNumFacesRep(false) : 0;
+  std::vector<VertexArray *> lines(nthreads, nullptr);
+  std::vector<VertexArray *> triangles(nthreads, nullptr);
+#pragma omp parallel num_threads(nthreads)
+  {
+    std::size_t t = Msg::GetThreadNum(), nt = Msg::GetNumThreads();
+    std::size_t start = (elements.size() * t) / nt;
+    std::size_t end = (elements.size() * (t + 1)) / nt;
+    if(t) {
+      if(edges) lines[t] = new VertexArray(2, numEdgesRep * (end - start));
+      if(faces) triangles[t] = new VertexArray(3, numFacesRep * (end - start));
     }
-
-    if(faces) {
-      bool unique = e->dim() > 2 && !CTX::instance()->pickElements;
-      bool skin = e->dim() > 2 && CTX::instance()->mesh.drawSkinOnly;
-      for(int j = 0; j < ele->getNumFacesRep(curved); j++) {
-        double x[3], y[3], z[3];
-        SVector3 n[3];
-        ele->getFaceRep(curved, j, x, y, z, n);
-        if(CTX::instance()->mesh.explode != 1.) {
-          for(int k = 0; k < 3; k++) {
-            x[k] = pc[0] + CTX::instance()->mesh.explode * (x[k] - pc[0]);
-            y[k] = pc[1] + CTX::instance()->mesh.explode * (y[k] - pc[1]);
-            z[k] = pc[2] + CTX::instance()->mesh.explode * (z[k] - pc[2]);
-          }
-        }
-        if(e->dim() == 2 && CTX::instance()->mesh.smoothNormals)
-          for(int k = 0; k < 3; k++)
-            e->model()->normals->get(x[k], y[k], z[k], n[k][0], n[k][1],
-                                     n[k][2]);
-#pragma omp critical
-        {
-          e->va_triangles->add(x, y, z, n, col, ele, unique, skin);
-        }
-      }
+    else {
+      lines[t] = e->va_lines;
+      triangles[t] = e->va_triangles;
+    }
+    for(std::size_t i = start; i < end; i++)
+      addElementInArrays(e, elements[i], edges, faces, lines[t],
+                         triangles[t]);
+  }
+  for(int t = 1; t < nthreads; t++) {
+    if(lines[t]) {
+      e->va_lines->merge(lines[t]);
+      delete lines[t];
+    }
+    if(triangles[t]) {
+      e->va_triangles->merge(triangles[t]);
+      delete triangles[t];
     }
   }
 }
 
+static void decimateArrays(GEntity *e)
+{
+  if(!CTX::instance()->mesh.levelOfDetail) return;
+  double cellSize = CTX::instance()->lc / CTX::instance()->mesh.levelOfDetail;
+  if(e->va_lines) e->va_lines_lod = e->va_lines->decimate(cellSize);
+  if(e->va_triangles)
+    e->va_triangles_lod = e->va_triangles->decimate(cellSize, e->dim() == 3);
+}
+
 class initMeshGEdge {
 private:
   int _estimateNumLines(GEdge *e)
@@ -286,6 +335,7 @@ public:
       e->va_lines = new VertexArray(2, _estimateNumLines(e));
       addElementsInArrays(e, e->lines, CTX::instance()->mesh.lines, false);
       e->va_lines->finalize();
+      decimateArrays(e);
     }
   }
 };
@@ -349,6 +399,7 @@ public:
       addElementsInArrays(f, f->polygons, edg, fac);
       f->va_lines->finalize();
       f->va_triangles->finalize();
+      decimateArrays(f);
     }
   }
 };
@@ -445,10 +496,33 @@ public:
       addElementsInArrays(r, r->polyhedra, edg, fac);
       r->va_lines->finalize();
       r->va_triangles->finalize();
+      decimateArrays(r);
     }
   }
 };
 
+template <class T, class F>
+static void initMeshEntities(std::vector<T *> &entities)
+{
+  // small entities are processed concurrently, whereas large entities are
+  // processed one after the other, with parallelism over their elements
+  std::vector<T *> small, large;
+  for(std::size_t i = 0; i < entities.size(); i++) {
+    if(entities[i]->getNumMeshElements() < 10000)
+      small.push_back(entities[i]);
+    else
+      large.push_back(entities[i]);
+  }
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+  for(std::size_t i = 0; i < small.size(); i++) {
+    F f;
+    f(small[i]);
+  }
+  std::for_each(large.begin(), large.end(), F());
+}
+
 bool GModel::fillVertexArrays()
 {
   if(!getVisibility() || !CTX::instance()->mesh.changed) return false;
@@ -457,18 +531,23 @@ bool GModel::fillVertexArrays()
 
   int status = getMeshStatus();
 
-  if(status >= 1 && CTX::instance()->mesh.changed & ENT_CURVE)
-    std::for_each(firstEdge(), lastEdge(), initMeshGEdge());
+  if(status >= 1 && CTX::instance()->mesh.changed & ENT_CURVE) {
+    std::vector<GEdge *> edges(firstEdge(), lastEdge());
+    initMeshEntities<GEdge, initMeshGEdge>(edges);
+  }
 
   if(status >= 2 && CTX::instance()->mesh.changed & ENT_SURFACE) {
     if(normals) delete normals;
     normals = new smooth_normals(CTX::instance()->mesh.angleSmoothNormals);
     if(CTX::instance()->mesh.smoothNormals)
       std::for_each(firstFace(), lastFace(), initSmoothNormalsGFace());
-    std::for_each(firstFace(), lastFace(), initMeshGFace());
+    std::vector<GFace *> faces(firstFace(), lastFace());
+    initMeshEntities<GFace, initMeshGFace>(faces);
   }
 
-  if(status >= 3 && CTX::instance()->mesh.changed & ENT_VOLUME)
-    std::for_each(firstRegion(), lastRegion(), initMeshGRegion());
+  if(status >= 3 && CTX::instance()->mesh.changed & ENT_VOLUME) {
+    std::vector<GRegion *> regions(firstRegion(), lastRegion());
+    initMeshEntities<GRegion, initMeshGRegion>(regions);
+  }
   return true;
 }
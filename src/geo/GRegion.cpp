@@ -43,6 +43,8 @@ void GRegion::deleteMesh()
   transfinite_vertices.clear();
   removeElements(true);
   deleteVertexArrays();
+  deleteMeshElementQualities();
+  deleteCompactConnectivity();
   model()->destroyMeshCaches();
 }
 
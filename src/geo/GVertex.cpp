@@ -23,6 +23,8 @@ void GVertex::deleteMesh()
   mesh_vertices.clear();
   removeElements(true);
   deleteVertexArrays();
+  deleteMeshElementQualities();
+  deleteCompactConnectivity();
   model()->destroyMeshCaches();
 }
 
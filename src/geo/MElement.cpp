@@ -295,6 +295,56 @@ double MElement::minScaledJacobian(bool knownValid, bool reversedOK)
 #endif
 }
 
+static const char *_qualityMeasureNames[] = {
+  "minSICN",     "minSIGE",     "minSJ",      "gamma",
+  "eta",         "volume",      "minEdge",    "maxEdge",
+  "outerRadius", "innerRadius", "angleShape", "minIsotropy",
+  "minDetJac",   "maxDetJac"};
+
+// measures from the first unsafe one onwards use the (global) memory pools of
+// bezierCoeff
+static const int _firstThreadUnsafeQualityMeasure = 11;
+
+int MElement::getQualityMeasureIndex(const std::string &name)
+{
+  const int n = sizeof(_qualityMeasureNames) / sizeof(_qualityMeasureNames[0]);
+  for(int i = 0; i < n; i++)
+    if(name == _qualityMeasureNames[i]) return i;
+  return -1;
+}
+
+bool MElement::isQualityMeasureThreadSafe(int index)
+{
+  return index >= 0 && index < _firstThreadUnsafeQualityMeasure;
+}
+
+double MElement::getQualityMeasure(int index)
+{
+  switch(index) {
+  case 0: return minSICNShapeMeasure();
+  case 1: return minSIGEShapeMeasure();
+  case 2: return distoShapeMeasure();
+  case 3: return gammaShapeMeasure();
+  case 4: return etaShapeMeasure();
+  case 5: return getVolume();
+  case 6: return minEdge();
+  case 7: return maxEdge();
+  case 8: return getOuterRadius();
+  case 9: return getInnerRadius();
+  case 10: return angleShapeMeasure();
+  case 11: return minIsotropyMeasure();
+#if defined(HAVE_MESH)
+  case 12:
+  case 13: {
+    double min, max;
+    jacobianBasedQuality::minMaxJacobianDeterminant(this, min, max);
+    return (index == 12) ? min : max;
+  }
+#endif
+  default: return 0.;
+  }
+}
+
 void MElement::scaledJacRange(double &jmin, double &jmax, GEntity *ge) const
 {
   jmin = jmax = 1.0;
@@ -923,6 +973,43 @@ double MElement::getJacobian(const std::vector<SVector3> &gsf,
   return _computeDeterminantAndRegularize(this, jac);
 }
 
+void MElement::getJacobians(const std::vector<MElement *> &elements,
+                            const fullMatrix<double> &gsf, double *jac,
+                            double *det)
+{
+  const int numPoints = gsf.size1() / 3;
+  const int numNodes = gsf.size2();
+  const int numElements = elements.size();
+  if(!numPoints || !numElements) return;
+
+  fullMatrix<double> xyz(numNodes, 3 * numElements);
+  for(int e = 0; e < numElements; e++) {
+    for(int i = 0; i < numNodes; i++) {
+      const MVertex *v = elements[e]->getShapeFunctionNode(i);
+      xyz(i, 3 * e + 0) = v->x();
+      xyz(i, 3 * e + 1) = v->y();
+      xyz(i, 3 * e + 2) = v->z();
+    }
+  }
+  fullMatrix<double> J(3 * numPoints, 3 * numElements);
+  gsf.mult(xyz, J);
+
+  double tmp[9];
+  for(int e = 0; e < numElements; e++) {
+    for(int k = 0; k < numPoints; k++) {
+      const std::size_t idx = (std::size_t)e * numPoints + k;
+      double *j = jac ? &jac[9 * idx] : tmp;
+      for(int i = 0; i < 3; i++) {
+        j[3 * i + 0] = J(3 * k + i, 3 * e + 0);
+        j[3 * i + 1] = J(3 * k + i, 3 * e + 1);
+        j[3 * i + 2] = J(3 * k + i, 3 * e + 2);
+      }
+      const double d = _computeDeterminantAndRegularize(elements[e], j);
+      if(det) det[idx] = d;
+    }
+  }
+}
+
 double MElement::getJacobian(double u, double v, double w,
                              fullMatrix<double> &j) const
 {
@@ -286,6 +286,16 @@ public:
                                      GEntity *ge = nullptr);
   virtual void signedInvGradErrorRange(double &minSIGE, double &maxSIGE);
 
+  // get the quality measures by name ("minSICN", "minSIGE", "minSJ", "gamma",
+  // "eta", "minIsotropy", "angleShape", "volume", "minEdge", "maxEdge",
+  // "outerRadius", "innerRadius", "minDetJac" or "maxDetJac"):
+  // getQualityMeasureIndex() returns -1 if the name is unknown, and
+  // isQualityMeasureThreadSafe() tells if the measure can be evaluated
+  // concurrently on different elements
+  static int getQualityMeasureIndex(const std::string &name);
+  static bool isQualityMeasureThreadSafe(int index);
+  double getQualityMeasure(int index);
+
   // get the radius of the inscribed circle/sphere if it exists, otherwise get
   // the minimum radius of all the circles/spheres tangent to the most
   // boundaries of the element.
@@ -371,6 +381,15 @@ public:
   virtual double getJacobian(double u, double v, double w,
                              double jac[3][3]) const;
   double getJacobian(double u, double v, double w, fullMatrix<double> &j) const;
+  // compute the Jacobians (row-major arrays, as above) and their determinants
+  // at G points for a block of E elements of the same type, given the
+  // gradients of the N shape functions at the points in gsf (3G x N, row 3 * g
+  // + i holding the derivatives along u_i): the Jacobians of all the elements
+  // are obtained with a single (3G x N) x (N x 3E) matrix product. jac (9GE
+  // values) and det (GE values) can be null.
+  static void getJacobians(const std::vector<MElement *> &elements,
+                           const fullMatrix<double> &gsf, double *jac,
+                           double *det);
   virtual double getPrimaryJacobian(double u, double v, double w,
                                     double jac[3][3]) const;
   double getJacobianDeterminant(double u, double v, double w) const
@@ -91,39 +91,44 @@ private:
     out->push_back(v);
     return true;
   }
-  void _find(int dim, const TopoDS_Shape &shape,
-             std::vector<OCCAttributes *> &attr, bool requireMeshSize,
-             bool requireExtrudeParams, bool requireLabel, bool requireColor,
-             bool excludeSame)
+  // get the center of the bounding box of the shape and the attributes stored
+  // around it
+  bool _search(int dim, const TopoDS_Shape &shape, double bbox[6],
+               std::vector<OCCAttributes *> &tmp)
   {
-    attr.clear();
-    if(dim < 0 || dim > 3) return;
+    tmp.clear();
+    if(dim < 0 || dim > 3) return false;
     Bnd_Box box;
     try {
       BRepBndLib::Add(shape, box, Standard_False);
       if(box.IsVoid()) {
         Msg::Debug(
           "Searching for (null or degenerate) shape with void bounding box");
-        return;
+        return false;
       }
     } catch(Standard_Failure &err) {
       Msg::Error("OpenCASCADE exception %s", err.GetMessageString());
-      return;
+      return false;
     }
-    double xmin, ymin, zmin, xmax, ymax, zmax;
-    box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-    double x = 0.5 * (xmin + xmax);
-    double y = 0.5 * (ymin + ymax);
-    double z = 0.5 * (zmin + zmax);
+    box.Get(bbox[0], bbox[1], bbox[2], bbox[3], bbox[4], bbox[5]);
+    double x = 0.5 * (bbox[0] + bbox[3]);
+    double y = 0.5 * (bbox[1] + bbox[4]);
+    double z = 0.5 * (bbox[2] + bbox[5]);
     double bmin[3] = {x - _tol, y - _tol, z - _tol};
     double bmax[3] = {x + _tol, y + _tol, z + _tol};
-    std::vector<OCCAttributes *> tmp;
     _rtree[dim]->Search(bmin, bmax, rtree_callback, &tmp);
     Msg::Debug("OCCRTree found %d matches at (%g,%g,%g) in tree of size %d",
                (int)tmp.size(), x, y, z, (int)_all.size());
-    if(tmp.empty()) { // no match
-      return;
-    }
+    return !tmp.empty();
+  }
+  // filter the attributes found by _search()
+  void _filter(const TopoDS_Shape &shape, const double bbox[6],
+               const std::vector<OCCAttributes *> &tmp,
+               std::vector<OCCAttributes *> &attr, bool requireMeshSize,
+               bool requireExtrudeParams, bool requireLabel, bool requireColor,
+               bool excludeSame)
+  {
+    attr.clear();
     if(!excludeSame) {
       for(std::size_t i = 0; i < tmp.size(); i++) {
         if(requireMeshSize && tmp[i]->getMeshSize() == MAX_LC) continue;
@@ -147,15 +152,66 @@ private:
       BRepBndLib::Add(tmp[i]->getShape(), box2, Standard_False);
       double xmin2, ymin2, zmin2, xmax2, ymax2, zmax2;
       box2.Get(xmin2, ymin2, zmin2, xmax2, ymax2, zmax2);
-      if(std::abs(xmin - xmin2) < _tol && std::abs(xmax - xmax2) < _tol &&
-         std::abs(ymin - ymin2) < _tol && std::abs(ymax - ymax2) < _tol &&
-         std::abs(zmin - zmin2) < _tol && std::abs(zmax - zmax2) < _tol) {
+      if(std::abs(bbox[0] - xmin2) < _tol && std::abs(bbox[3] - xmax2) < _tol &&
+         std::abs(bbox[1] - ymin2) < _tol && std::abs(bbox[4] - ymax2) < _tol &&
+         std::abs(bbox[2] - zmin2) < _tol && std::abs(bbox[5] - zmax2) < _tol) {
         attr.push_back(tmp[i]);
       }
     }
     Msg::Debug("OCCRtree %d matches after bounding box filtering",
                (int)attr.size());
   }
+  void _find(int dim, const TopoDS_Shape &shape,
+             std::vector<OCCAttributes *> &attr, bool requireMeshSize,
+             bool requireExtrudeParams, bool requireLabel, bool requireColor,
+             bool excludeSame)
+  {
+    attr.clear();
+    double bbox[6];
+    std::vector<OCCAttributes *> tmp;
+    if(!_search(dim, shape, bbox, tmp)) return; // no match
+    _filter(shape, bbox, tmp, attr, requireMeshSize, requireExtrudeParams,
+            requireLabel, requireColor, excludeSame);
+  }
+  static double _getMeshSize(const std::vector<OCCAttributes *> &attr)
+  {
+    for(std::size_t i = 0; i < attr.size(); i++) {
+      if(attr[i]->getMeshSize() < MAX_LC) return attr[i]->getMeshSize();
+    }
+    return MAX_LC;
+  }
+  static void _getLabels(const std::vector<OCCAttributes *> &attr,
+                         std::vector<std::string> &labels)
+  {
+    labels.clear();
+    for(std::size_t i = 0; i < attr.size(); i++) {
+      if(!attr[i]->getLabel().empty()) labels.push_back(attr[i]->getLabel());
+    }
+  }
+  static bool _getColor(const std::vector<OCCAttributes *> &attr,
+                        unsigned int &color, unsigned int &boundary)
+  {
+    for(std::size_t i = 0; i < attr.size(); i++) {
+      const std::vector<double> &col = attr[i]->getColor();
+      if(col.size() >= 3) {
+        int r = static_cast<int>(col[0] * 255. + 0.5);
+        r = (r < 0) ? 0 : (r > 255) ? 255 : r;
+        int g = static_cast<int>(col[1] * 255. + 0.5);
+        g = (g < 0) ? 0 : (g > 255) ? 255 : g;
+        int b = static_cast<int>(col[2] * 255. + 0.5);
+        b = (b < 0) ? 0 : (b > 255) ? 255 : b;
+        int a = 255;
+        if(col.size() >= 4) {
+          int a = static_cast<int>(col[3] * 255. + 0.5);
+          a = (a < 0) ? 0 : (a > 255) ? 255 : a;
+        }
+        color = CTX::instance()->packColor(r, g, b, a);
+        boundary = (col.size() == 5) ? col[4] : 0;
+        return true;
+      }
+    }
+    return false;
+  }
 
 public:
   OCCAttributesRTree(double tolerance = 1.e-8)
@@ -254,10 +310,7 @@ public:
   {
     std::vector<OCCAttributes *> attr;
     _find(dim, shape, attr, true, false, false, false, false);
-    for(std::size_t i = 0; i < attr.size(); i++) {
-      if(attr[i]->getMeshSize() < MAX_LC) return attr[i]->getMeshSize();
-    }
-    return MAX_LC;
+    return _getMeshSize(attr);
   }
   ExtrudeParams *getExtrudeParams(int dim, TopoDS_Shape shape, int &sourceDim,
                                   TopoDS_Shape &sourceShape)
@@ -275,38 +328,35 @@ public:
   }
   void getLabels(int dim, TopoDS_Shape shape, std::vector<std::string> &labels)
   {
-    labels.clear();
     std::vector<OCCAttributes *> attr;
     _find(dim, shape, attr, false, false, true, false, false);
-    for(std::size_t i = 0; i < attr.size(); i++) {
-      if(!attr[i]->getLabel().empty()) labels.push_back(attr[i]->getLabel());
-    }
+    _getLabels(attr, labels);
   }
   bool getColor(int dim, TopoDS_Shape shape, unsigned int &color,
                 unsigned int &boundary)
   {
     std::vector<OCCAttributes *> attr;
     _find(dim, shape, attr, false, false, false, true, false);
-    for(std::size_t i = 0; i < attr.size(); i++) {
-      const std::vector<double> &col = attr[i]->getColor();
-      if(col.size() >= 3) {
-        int r = static_cast<int>(col[0] * 255. + 0.5);
-        r = (r < 0) ? 0 : (r > 255) ? 255 : r;
-        int g = static_cast<int>(col[1] * 255. + 0.5);
-        g = (g < 0) ? 0 : (g > 255) ? 255 : g;
-        int b = static_cast<int>(col[2] * 255. + 0.5);
-        b = (b < 0) ? 0 : (b > 255) ? 255 : b;
-        int a = 255;
-        if(col.size() >= 4) {
-          int a = static_cast<int>(col[3] * 255. + 0.5);
-          a = (a < 0) ? 0 : (a > 255) ? 255 : a;
-        }
-        color = CTX::instance()->packColor(r, g, b, a);
-        boundary = (col.size() == 5) ? col[4] : 0;
-        return true;
-      }
-    }
-    return false;
+    return _getColor(attr, color, boundary);
+  }
+  // get the mesh size, the labels and the color of a shape (same as
+  // getMeshSize(), getLabels() and getColor()) with a single search in the
+  // tree; only reads the tree, so can be called concurrently
+  bool getMeshSizeLabelsAndColor(int dim, TopoDS_Shape shape, double &meshSize,
+                                 std::vector<std::string> &labels,
+                                 unsigned int &color, unsigned int &boundary)
+  {
+    meshSize = MAX_LC;
+    labels.clear();
+    double bbox[6];
+    std::vector<OCCAttributes *> tmp, attr;
+    if(!_search(dim, shape, bbox, tmp)) return false;
+    _filter(shape, bbox, tmp, attr, true, false, false, false, false);
+    meshSize = _getMeshSize(attr);
+    _filter(shape, bbox, tmp, attr, false, false, true, false, false);
+    _getLabels(attr, labels);
+    _filter(shape, bbox, tmp, attr, false, false, false, true, false);
+    return _getColor(attr, color, boundary);
   }
   void getSimilarShapes(int dim, TopoDS_Shape shape,
                         std::vector<TopoDS_Shape> &other)
@@ -34,6 +34,7 @@
 #include <BRepAdaptor_Surface.hxx>
 #include <BRep_Builder.hxx>
 #include <BOPTools_AlgoTools.hxx>
+#include <Precision.hxx>
 
 OCCEdge::OCCEdge(GModel *m, TopoDS_Edge c, int num, GVertex *v1, GVertex *v2)
   : GEdge(m, num, v1, v2), _c(c), _trimmed(nullptr)
@@ -52,8 +53,8 @@ OCCEdge::OCCEdge(GModel *m, TopoDS_Edge c, int num, GVertex *v1, GVertex *v2)
   _nbpoles = 0;
 
   if(!_curve.IsNull()) {
-    // initialize projector, with a little tolerance to converge on the boundary
-    // points
+    // parameter bounds of the projectors, with a little tolerance to converge
+    // on the boundary points; the projectors are created on demand
     double umin = _s0;
     double umax = _s1;
     if(_v0 != _v1) {
@@ -62,7 +63,8 @@ OCCEdge::OCCEdge(GModel *m, TopoDS_Edge c, int num, GVertex *v1, GVertex *v2)
       umin -= utol;
       umax += utol;
     }
-    _projector.Init(_curve, umin, umax);
+    _projectorBounds[0] = umin;
+    _projectorBounds[1] = umax;
 
     // keep track of number of poles for drawing
     if(_curve->DynamicType() == STANDARD_TYPE(Geom_BSplineCurve))
@@ -72,6 +74,11 @@ OCCEdge::OCCEdge(GModel *m, TopoDS_Edge c, int num, GVertex *v1, GVertex *v2)
   }
 }
 
+OCCEdge::~OCCEdge()
+{
+  for(std::size_t i = 0; i < _projectors.size(); i++) delete _projectors[i];
+}
+
 void OCCEdge::delFace(GFace *f)
 {
   if(_trimmed == f) _trimmed = nullptr;
@@ -208,6 +215,57 @@ SPoint2 OCCEdge::reparamOnFace(const GFace *face, double epar, int dir) const
   }
 }
 
+OCCEdge::projector *OCCEdge::_getProjector() const
+{
+  projector *pr = nullptr;
+#pragma omp critical(OCCEdgeProjectors)
+  {
+    if(!_projectors.empty()) {
+      pr = _projectors.back();
+      _projectors.pop_back();
+    }
+  }
+  if(!pr) {
+    pr = new projector;
+    pr->proj.Init(_curve, _projectorBounds[0], _projectorBounds[1]);
+    pr->hit = false;
+  }
+  return pr;
+}
+
+void OCCEdge::_releaseProjector(projector *pr) const
+{
+#pragma omp critical(OCCEdgeProjectors)
+  _projectors.push_back(pr);
+}
+
+bool OCCEdge::_projectLocal(const double p[3], double u0, double &u,
+                            double xyz[3]) const
+{
+  // Newton iterations starting from u0, only accepted if they converge to a
+  // point of the curve, inside the parameter bounds (see OCCFace)
+  u = u0;
+  for(int iter = 0; iter < 5; iter++) {
+    if(u < _projectorBounds[0] || u > _projectorBounds[1]) return false;
+    gp_Pnt pnt;
+    gp_Vec du;
+    _curve->D1(u, pnt, du);
+    gp_Vec r(pnt, gp_Pnt(p[0], p[1], p[2]));
+    if(r.Magnitude() < Precision::Confusion()) {
+      if(xyz) {
+        xyz[0] = pnt.X();
+        xyz[1] = pnt.Y();
+        xyz[2] = pnt.Z();
+      }
+      return true;
+    }
+    double a = du.Dot(du);
+    if(a <= 0.) return false;
+    u += r.Dot(du) / a;
+  }
+  return false;
+}
+
 bool OCCEdge::_project(const double p[3], double &u, double xyz[3]) const
 {
   if(_curve.IsNull()) {
@@ -215,26 +273,33 @@ bool OCCEdge::_project(const double p[3], double &u, double xyz[3]) const
     return false;
   }
 
-  gp_Pnt pnt(p[0], p[1], p[2]);
-  _projector.Perform(pnt);
+  projector *pr = _getProjector();
+  if(!pr->hit || !_projectLocal(p, pr->u, u, xyz)) {
+    gp_Pnt pnt(p[0], p[1], p[2]);
+    pr->proj.Perform(pnt);
 
-  if(!_projector.NbPoints()) {
-    Msg::Debug("Projection of point (%g, %g, %g) on curve %d failed", p[0],
-               p[1], p[2], tag());
-    return false;
-  }
+    if(!pr->proj.NbPoints()) {
+      Msg::Debug("Projection of point (%g, %g, %g) on curve %d failed", p[0],
+                 p[1], p[2], tag());
+      _releaseProjector(pr);
+      return false;
+    }
 
-  u = _projector.LowerDistanceParameter();
+    u = pr->proj.LowerDistanceParameter();
 
-  if(u < _s0 || u > _s1)
-    Msg::Debug("Point projection is out of curve parameter bounds");
+    if(u < _s0 || u > _s1)
+      Msg::Debug("Point projection is out of curve parameter bounds");
 
-  if(xyz) {
-    pnt = _projector.NearestPoint();
-    xyz[0] = pnt.X();
-    xyz[1] = pnt.Y();
-    xyz[2] = pnt.Z();
+    if(xyz) {
+      pnt = pr->proj.NearestPoint();
+      xyz[0] = pnt.X();
+      xyz[1] = pnt.Y();
+      xyz[2] = pnt.Z();
+    }
   }
+  pr->u = u;
+  pr->hit = true;
+  _releaseProjector(pr);
   return true;
 }
 
@@ -15,6 +15,7 @@ class OCCFace;
 
 #if defined(HAVE_OCC)
 
+#include <vector>
 #include <BRep_Tool.hxx>
 #include <Geom2d_Curve.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
@@ -30,12 +31,24 @@ private:
   Handle(Geom_Curve) _curve;
   mutable Handle(Geom2d_Curve) _curve2d;
   mutable GFace *_trimmed;
-  mutable GeomAPI_ProjectPointOnCurve _projector;
+  // pool of projectors, with the parameter of their last projection (see
+  // OCCFace)
+  struct projector {
+    GeomAPI_ProjectPointOnCurve proj;
+    double u;
+    bool hit;
+  };
+  double _projectorBounds[2];
+  mutable std::vector<projector *> _projectors;
+  projector *_getProjector() const;
+  void _releaseProjector(projector *pr) const;
+  bool _projectLocal(const double p[3], double u0, double &u,
+                     double xyz[3]) const;
   bool _project(const double p[3], double &u, double xyz[3]) const;
 
 public:
   OCCEdge(GModel *model, TopoDS_Edge c, int num, GVertex *v1, GVertex *v2);
-  virtual ~OCCEdge() {}
+  virtual ~OCCEdge();
   void delFace(GFace *f);
   virtual SBoundingBox3d bounds(bool fast = false);
   virtual Range<double> parBounds(int i) const;
@@ -20,7 +20,6 @@
 #include <BOPTools_AlgoTools2D.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepClass_FaceClassifier.hxx>
-#include <BRepLProp_SLProps.hxx>
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 #include <Bnd_Box.hxx>
@@ -32,7 +31,9 @@
 #include <Geom_SphericalSurface.hxx>
 #include <Geom_SurfaceOfRevolution.hxx>
 #include <Geom_ToroidalSurface.hxx>
+#include <GeomLProp_SLProps.hxx>
 #include <IntTools_Context.hxx>
+#include <Precision.hxx>
 #include <ShapeAnalysis.hxx>
 #include <ShapeFix_Wire.hxx>
 #include <Standard_Version.hxx>
@@ -42,7 +43,7 @@
 #include <gp_Sphere.hxx>
 
 OCCFace::OCCFace(GModel *m, TopoDS_Face s, int num)
-  : GFace(m, num), _s(s), _sf(s, Standard_True), _radius(-1)
+  : GFace(m, num), _s(s), _param(nullptr)
 {
   _setup();
 
@@ -51,6 +52,12 @@ OCCFace::OCCFace(GModel *m, TopoDS_Face s, int num)
     writeBREP("debugSurface.brep");
 }
 
+OCCFace::~OCCFace()
+{
+  for(std::size_t i = 0; i < _projectors.size(); i++) delete _projectors[i];
+  delete _param.load();
+}
+
 void OCCFace::_setup()
 {
   edgeLoops.clear();
@@ -138,46 +145,8 @@ void OCCFace::_setup()
     }
   }
 
-  BRepAdaptor_Surface surface(_s);
-  _periodic[0] = surface.IsUPeriodic();
-  _periodic[1] = surface.IsVPeriodic();
-  if(_periodic[0]) _period[0] = surface.UPeriod();
-  if(_periodic[1]) _period[1] = surface.VPeriod();
-
-  ShapeAnalysis::GetFaceUVBounds(_s, _umin, _umax, _vmin, _vmax);
-  Msg::Debug("OCC surface %d with %d parameter bounds (%g,%g)(%g,%g)", tag(),
-             l_edges.size(), _umin, _umax, _vmin, _vmax);
-
   _occface = BRep_Tool::Surface(_s);
 
-  // init projector, with little tolerance to converge on the borders of the
-  // surface
-  double umin = _umin;
-  double vmin = _vmin;
-  double umax = _umax;
-  double vmax = _vmax;
-  if(!_periodic[0]) {
-    const double du = _umax - _umin;
-    const double utol = std::max(fabs(du) * 1e-8, 1e-12);
-    umin -= utol;
-    umax += utol;
-  }
-  if(!_periodic[1]) {
-    const double dv = _vmax - _vmin;
-    const double vtol = std::max(fabs(dv) * 1e-8, 1e-12);
-    vmin -= vtol;
-    vmax += vtol;
-  }
-  _projector.Init(_occface, umin, umax, vmin, vmax);
-
-  if(OCCFace::geomType() == GEntity::Sphere) {
-    BRepAdaptor_Surface surface(_s);
-    gp_Sphere sphere = surface.Sphere();
-    _radius = sphere.Radius();
-    gp_Pnt loc = sphere.Location();
-    _center = SPoint3(loc.X(), loc.Y(), loc.Z());
-  }
-
   // Only store references to this new face in edges at the end of the
   // constructor, to avoid accessing it too early (e.g. when drawing an edge)
   for(std::size_t i = 0; i < l_edges.size(); i++) {
@@ -195,6 +164,62 @@ void OCCFace::_setup()
   }
 }
 
+const OCCFace::parametrization &OCCFace::_getParametrization() const
+{
+  parametrization *p = _param.load(std::memory_order_acquire);
+  if(p) return *p;
+#pragma omp critical(OCCFaceParametrization)
+  {
+    p = _param.load(std::memory_order_acquire);
+    if(!p) {
+      p = new parametrization;
+      BRepAdaptor_Surface sf(_s, Standard_True);
+      p->periodic[0] = sf.IsUPeriodic();
+      p->periodic[1] = sf.IsVPeriodic();
+      p->period[0] = p->periodic[0] ? sf.UPeriod() : 0.;
+      p->period[1] = p->periodic[1] ? sf.VPeriod() : 0.;
+
+      ShapeAnalysis::GetFaceUVBounds(_s, p->umin, p->umax, p->vmin, p->vmax);
+      Msg::Debug("OCC surface %d with %d parameter bounds (%g,%g)(%g,%g)",
+                 tag(), l_edges.size(), p->umin, p->umax, p->vmin, p->vmax);
+
+      // parameter bounds of the projectors, with little tolerance to converge
+      // on the borders of the surface; the projectors are created on demand
+      double umin = p->umin;
+      double vmin = p->vmin;
+      double umax = p->umax;
+      double vmax = p->vmax;
+      if(!p->periodic[0]) {
+        const double du = p->umax - p->umin;
+        const double utol = std::max(fabs(du) * 1e-8, 1e-12);
+        umin -= utol;
+        umax += utol;
+      }
+      if(!p->periodic[1]) {
+        const double dv = p->vmax - p->vmin;
+        const double vtol = std::max(fabs(dv) * 1e-8, 1e-12);
+        vmin -= vtol;
+        vmax += vtol;
+      }
+      p->projectorBounds[0] = umin;
+      p->projectorBounds[1] = umax;
+      p->projectorBounds[2] = vmin;
+      p->projectorBounds[3] = vmax;
+
+      p->radius = -1;
+      if(OCCFace::geomType() == GEntity::Sphere) {
+        gp_Sphere sphere = sf.Sphere();
+        p->radius = sphere.Radius();
+        gp_Pnt loc = sphere.Location();
+        p->center = SPoint3(loc.X(), loc.Y(), loc.Z());
+      }
+
+      _param.store(p, std::memory_order_release);
+    }
+  }
+  return *p;
+}
+
 SBoundingBox3d OCCFace::bounds(bool fast)
 {
   if(CTX::instance()->geom.occBoundsUseSTL) {
@@ -230,8 +255,9 @@ SBoundingBox3d OCCFace::bounds(bool fast)
 
 Range<double> OCCFace::parBounds(int i) const
 {
-  if(i == 0) return Range<double>(_umin, _umax);
-  return Range<double>(_vmin, _vmax);
+  const parametrization &p = _getParametrization();
+  if(i == 0) return Range<double>(p.umin, p.umax);
+  return Range<double>(p.vmin, p.vmax);
 }
 
 SVector3 OCCFace::normal(const SPoint2 &param) const
@@ -277,26 +303,109 @@ GPoint OCCFace::point(double par1, double par2) const
   return GPoint(val.X(), val.Y(), val.Z(), this, pp);
 }
 
-bool OCCFace::_project(const double p[3], double uv[2], double xyz[3]) const
+OCCFace::projector *OCCFace::_getProjector() const
 {
-  gp_Pnt pnt(p[0], p[1], p[2]);
-  _projector.Perform(pnt);
-  if(!_projector.NbPoints()) {
-    Msg::Debug("Projection of point (%g, %g, %g) on surface %d failed", p[0],
-               p[1], p[2], tag());
-    return false;
+  projector *pr = nullptr;
+#pragma omp critical(OCCFaceProjectors)
+  {
+    if(!_projectors.empty()) {
+      pr = _projectors.back();
+      _projectors.pop_back();
+    }
+  }
+  if(!pr) {
+    const double *bounds = _getParametrization().projectorBounds;
+    pr = new projector;
+    pr->proj.Init(_occface, bounds[0], bounds[1], bounds[2], bounds[3]);
+    pr->hit = false;
   }
-  _projector.LowerDistanceParameters(uv[0], uv[1]);
+  return pr;
+}
 
-  if(uv[0] < _umin || uv[0] > _umax || uv[1] < _vmin || uv[1] > _vmax)
-    Msg::Debug("Point projection is out of surface parameter bounds");
+void OCCFace::_releaseProjector(projector *pr) const
+{
+#pragma omp critical(OCCFaceProjectors)
+  _projectors.push_back(pr);
+}
+
+bool OCCFace::_projectLocal(const double p[3], const double uv0[2],
+                            double uv[2], double xyz[3], int *numIter) const
+{
+  // Gauss-Newton iterations starting from uv0; only accepted if they converge
+  // to a point of the surface (i.e. if p is on the surface, which makes the
+  // local minimum of the distance also the global one), inside the parameter
+  // bounds
+  const double *bounds = _getParametrization().projectorBounds;
+  double u = uv0[0], v = uv0[1];
+  for(int iter = 0; iter < 5; iter++) {
+    if(numIter) *numIter = iter;
+    if(u < bounds[0] || u > bounds[1] || v < bounds[2] || v > bounds[3])
+      return false;
+    gp_Pnt pnt;
+    gp_Vec du, dv;
+    _occface->D1(u, v, pnt, du, dv);
+    gp_Vec r(pnt, gp_Pnt(p[0], p[1], p[2]));
+    if(r.Magnitude() < Precision::Confusion()) {
+      uv[0] = u;
+      uv[1] = v;
+      if(xyz) {
+        xyz[0] = pnt.X();
+        xyz[1] = pnt.Y();
+        xyz[2] = pnt.Z();
+      }
+      return true;
+    }
+    double a11 = du.Dot(du), a12 = du.Dot(dv), a22 = dv.Dot(dv);
+    double det = a11 * a22 - a12 * a12;
+    if(det <= 1e-12 * a11 * a22) return false; // degenerate point
+    double b1 = r.Dot(du), b2 = r.Dot(dv);
+    u += (a22 * b1 - a12 * b2) / det;
+    v += (a11 * b2 - a12 * b1) / det;
+  }
+  if(numIter) *numIter = 5;
+  return false;
+}
 
-  if(xyz) {
-    pnt = _projector.NearestPoint();
-    xyz[0] = pnt.X();
-    xyz[1] = pnt.Y();
-    xyz[2] = pnt.Z();
+bool OCCFace::_project(const double p[3], double uv[2], double xyz[3]) const
+{
+  projector *pr = _getProjector();
+  bool local = pr->hit && _projectLocal(p, pr->uv, uv, xyz);
+  if(!local) {
+    // try the initial guess provided by the projection cache, if enabled
+    double guess[2];
+    int iter = 0;
+    if(getProjectionInitialGuess(SPoint3(p[0], p[1], p[2]), guess)) {
+      local = _projectLocal(p, guess, uv, xyz, &iter);
+      _addProjectionStatistics(local, iter);
+    }
+  }
+  if(!local) {
+    gp_Pnt pnt(p[0], p[1], p[2]);
+    pr->proj.Perform(pnt);
+    if(!pr->proj.NbPoints()) {
+      Msg::Debug("Projection of point (%g, %g, %g) on surface %d failed", p[0],
+                 p[1], p[2], tag());
+      _releaseProjector(pr);
+      return false;
+    }
+    pr->proj.LowerDistanceParameters(uv[0], uv[1]);
+
+    const parametrization &par = _getParametrization();
+    if(uv[0] < par.umin || uv[0] > par.umax || uv[1] < par.vmin ||
+       uv[1] > par.vmax)
+      Msg::Debug("Point projection is out of surface parameter bounds");
+
+    if(xyz) {
+      pnt = pr->proj.NearestPoint();
+      xyz[0] = pnt.X();
+      xyz[1] = pnt.Y();
+      xyz[2] = pnt.Z();
+    }
   }
+  pr->uv[0] = uv[0];
+  pr->uv[1] = uv[1];
+  pr->hit = true;
+  _releaseProjector(pr);
   return true;
 }
 
@@ -352,8 +461,9 @@ GEntity::GeomType OCCFace::geomType() const
 double OCCFace::curvatureMax(const SPoint2 &param) const
 {
   const double eps = 1.e-12;
-  BRepLProp_SLProps prop(_sf, 2, eps);
-  prop.SetParameters(param.x(), param.y());
+  // evaluate the properties directly on the (thread-safe) surface, as the
+  // evaluation cache of the adaptors would be shared between threads
+  GeomLProp_SLProps prop(_occface, param.x(), param.y(), 2, eps);
 
   if(!prop.IsCurvatureDefined()) { return eps; }
 
@@ -365,8 +475,7 @@ double OCCFace::curvatures(const SPoint2 &param, SVector3 &dirMax,
                            double &curvMin) const
 {
   const double eps = 1.e-12;
-  BRepLProp_SLProps prop(_sf, 2, eps);
-  prop.SetParameters(param.x(), param.y());
+  GeomLProp_SLProps prop(_occface, param.x(), param.y(), 2, eps);
 
   if(!prop.IsCurvatureDefined()) { return -1.; }
 
@@ -436,8 +545,8 @@ bool OCCFace::isSphere(double &radius, SPoint3 &center) const
 {
   switch(geomType()) {
   case GEntity::Sphere:
-    radius = _radius;
-    center = _center;
+    radius = _getParametrization().radius;
+    center = _getParametrization().center;
     return true;
   default: return false;
   }
@@ -13,6 +13,9 @@
 
 #if defined(HAVE_OCC)
 
+#include <atomic>
+#include <vector>
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepLProp_SLProps.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
 #include <TopoDS_Face.hxx>
@@ -21,19 +24,42 @@ class OCCFace : public GFace {
 private:
   TopoDS_Face _s;
   Handle(Geom_Surface) _occface;
-  const BRepAdaptor_Surface _sf;
-  double _umin, _umax, _vmin, _vmax;
-  bool _periodic[2];
-  double _period[2];
-  double _radius;
-  SPoint3 _center;
   void _setup();
-  mutable GeomAPI_ProjectPointOnSurf _projector;
+  // data related to the parametrization of the surface; they are only needed
+  // to evaluate or project points, and are costly to compute (e.g. the
+  // parameter bounds), so they are computed on first use - once, even if
+  // requested concurrently
+  struct parametrization {
+    double umin, umax, vmin, vmax;
+    bool periodic[2];
+    double period[2];
+    double radius;
+    SPoint3 center;
+    // parameter bounds of the projectors
+    double projectorBounds[4];
+  };
+  mutable std::atomic<parametrization *> _param;
+  const parametrization &_getParametrization() const;
+  // GeomAPI_ProjectPointOnSurf is not thread-safe: concurrent projections on
+  // the same surface each use their own projector, taken from a pool. Each
+  // projector remembers the parameters of its last projection, which are used
+  // as initial guess for a few Newton iterations before falling back to a
+  // full projection
+  struct projector {
+    GeomAPI_ProjectPointOnSurf proj;
+    double uv[2];
+    bool hit;
+  };
+  mutable std::vector<projector *> _projectors;
+  projector *_getProjector() const;
+  void _releaseProjector(projector *pr) const;
+  bool _projectLocal(const double p[3], const double uv0[2], double uv[2],
+                     double xyz[3], int *numIter = nullptr) const;
   bool _project(const double p[3], double uv[2], double xyz[3]) const;
 
 public:
   OCCFace(GModel *m, TopoDS_Face s, int num);
-  virtual ~OCCFace() {}
+  virtual ~OCCFace();
   virtual SBoundingBox3d bounds(bool fast = false);
   virtual Range<double> parBounds(int i) const;
   virtual GPoint point(double par1, double par2) const;
@@ -56,8 +82,14 @@ public:
                             double &curvMin) const;
   // tells if it's a sphere, and if it is, returns parameters
   virtual bool isSphere(double &radius, SPoint3 &center) const;
-  virtual bool periodic(int dim) const { return _periodic[dim]; }
-  virtual double period(int dim) const { return _period[dim]; }
+  virtual bool periodic(int dim) const
+  {
+    return _getParametrization().periodic[dim];
+  }
+  virtual double period(int dim) const
+  {
+    return _getParametrization().period[dim];
+  }
   // save itself in BREP format (for debug e.g.)
   void writeBREP(const char *filename);
   bool buildSTLTriangulation(bool force = false);
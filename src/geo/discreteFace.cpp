@@ -623,6 +623,9 @@ void discreteFace::_computeSTLNormals()
 
 void discreteFace::_createGeometryFromSTL()
 {
+  // the parametrization changes: the sampling of the surface is obsolete
+  deleteProjectionCache();
+
   if(stl_triangles.empty() || stl_vertices_uv.empty() ||
      stl_vertices_xyz.empty())
     return;
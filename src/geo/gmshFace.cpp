@@ -39,6 +39,7 @@ bool gmshFace::degenerate(int dim) const
 void gmshFace::resetNativePtr(Surface *s)
 {
   _s = s;
+  deleteProjectionCache();
   l_edges.clear();
   l_dirs.clear();
   edgeLoops.clear();
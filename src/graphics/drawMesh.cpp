@@ -339,7 +339,20 @@ template <class T> static void drawVoronoiDual(std::vector<T *> &elements)
   gl2psDisable(GL2PS_LINE_STIPPLE);
 }
 
-// Routine for drawing the vertex arrays
+// Routines for drawing the vertex arrays
+
+static VertexArray *levelOfDetail(drawContext *ctx, VertexArray *va,
+                                  VertexArray *lod)
+{
+  // use the decimated array if the clustering cells are smaller than 2 pixels
+  // on screen (but never for picking)
+  if(!lod || !CTX::instance()->mesh.levelOfDetail ||
+     ctx->render_mode == drawContext::GMSH_SELECT)
+    return va;
+  double cellSize = CTX::instance()->lc / CTX::instance()->mesh.levelOfDetail;
+  double pixelSize = ctx->pixel_equiv_x / ctx->s[0];
+  return (cellSize < 2. * pixelSize) ? lod : va;
+}
 
 static void drawArrays(drawContext *ctx, GEntity *e, VertexArray *va,
                        GLint type, bool useNormalArray, int forceColor = 0,
@@ -464,7 +477,8 @@ public:
     glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, GL_FALSE);
 
     if(CTX::instance()->mesh.lines)
-      drawArrays(_ctx, e, e->va_lines, GL_LINES, false);
+      drawArrays(_ctx, e, levelOfDetail(_ctx, e->va_lines, e->va_lines_lod),
+                 GL_LINES, false);
 
     if(CTX::instance()->mesh.lineLabels) drawElementLabels(_ctx, e, e->lines);
 
@@ -507,7 +521,8 @@ public:
 
     glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, GL_FALSE);
 
-    drawArrays(_ctx, f, f->va_lines, GL_LINES,
+    drawArrays(_ctx, f, levelOfDetail(_ctx, f->va_lines, f->va_lines_lod),
+               GL_LINES,
                CTX::instance()->mesh.light && CTX::instance()->mesh.lightLines,
                CTX::instance()->mesh.surfaceFaces,
                CTX::instance()->color.mesh.line);
@@ -515,8 +530,9 @@ public:
     if(CTX::instance()->mesh.lightTwoSide)
       glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, GL_TRUE);
 
-    drawArrays(_ctx, f, f->va_triangles, GL_TRIANGLES,
-               CTX::instance()->mesh.light);
+    drawArrays(_ctx, f,
+               levelOfDetail(_ctx, f->va_triangles, f->va_triangles_lod),
+               GL_TRIANGLES, CTX::instance()->mesh.light);
 
     if(CTX::instance()->mesh.surfaceLabels) {
       if(CTX::instance()->mesh.triangles)
@@ -589,15 +605,16 @@ public:
     glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, GL_FALSE);
 
     drawArrays(
-      _ctx, r, r->va_lines, GL_LINES,
+      _ctx, r, levelOfDetail(_ctx, r->va_lines, r->va_lines_lod), GL_LINES,
       CTX::instance()->mesh.light && (CTX::instance()->mesh.lightLines > 1),
       CTX::instance()->mesh.volumeFaces, CTX::instance()->color.mesh.line);
 
     if(CTX::instance()->mesh.lightTwoSide)
       glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, GL_TRUE);
 
-    drawArrays(_ctx, r, r->va_triangles, GL_TRIANGLES,
-               CTX::instance()->mesh.light);
+    drawArrays(_ctx, r,
+               levelOfDetail(_ctx, r->va_triangles, r->va_triangles_lod),
+               GL_TRIANGLES, CTX::instance()->mesh.light);
 
     if(CTX::instance()->mesh.volumeLabels) {
       if(CTX::instance()->mesh.tetrahedra)
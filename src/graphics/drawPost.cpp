@@ -23,6 +23,21 @@
 #include <FL/gl.h>
 #endif
 
+static VertexArray *levelOfDetail(drawContext *ctx, PView *p, VertexArray *va,
+                                  VertexArray *lod)
+{
+  // use the decimated array if the clustering cells are smaller than 2 pixels
+  // on screen (but not with translucent views, which require sorting the full
+  // arrays)
+  if(!lod || !CTX::instance()->post.levelOfDetail ||
+     (CTX::instance()->alpha &&
+      ColorTable_IsAlpha(&p->getOptions()->colorTable)))
+    return va;
+  double cellSize = CTX::instance()->lc / CTX::instance()->post.levelOfDetail;
+  double pixelSize = ctx->pixel_equiv_x / ctx->s[0];
+  return (cellSize < 2. * pixelSize) ? lod : va;
+}
+
 static void drawArrays(drawContext *ctx, PView *p, VertexArray *va, GLint type,
                        bool useNormalArray)
 {
@@ -541,11 +556,14 @@ public:
     glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, GL_FALSE);
 
     drawArrays(_ctx, p, p->va_points, GL_POINTS, false);
-    drawArrays(_ctx, p, p->va_lines, GL_LINES, opt->light && opt->lightLines);
+    drawArrays(_ctx, p, levelOfDetail(_ctx, p, p->va_lines, p->va_lines_lod),
+               GL_LINES, opt->light && opt->lightLines);
 
     if(opt->lightTwoSide) glLightModelf(GL_LIGHT_MODEL_TWO_SIDE, GL_TRUE);
 
-    drawArrays(_ctx, p, p->va_triangles, GL_TRIANGLES, opt->light);
+    drawArrays(_ctx, p,
+               levelOfDetail(_ctx, p, p->va_triangles, p->va_triangles_lod),
+               GL_TRIANGLES, opt->light);
 
     // draw the "pseudo" vertex arrays for vectors
     drawVectorArray(_ctx, p, p->va_vectors);
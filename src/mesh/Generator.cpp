@@ -153,31 +153,51 @@ public:
   }
 };
 
-template <class T>
+// add v to the histogram h of 100 bins ]min + j * w, min + (j + 1) * w],
+// with w = (max - min) / 100
+static void AddToHistogram(double v, int min, int max, double h[100])
+{
+  if(!(v > min && v <= max)) return;
+  const int j = (int)std::ceil((v - min) * 100. / (max - min)) - 1;
+  for(int k = std::max(j - 1, 0); k <= std::min(j + 1, 99); k++) {
+    if(v > (min * (100 - k) + max * k) / 100. &&
+       v <= (min * (99 - k) + max * (k + 1)) / 100.) {
+      h[k]++;
+      return;
+    }
+  }
+}
+
 static void
-GetQualityMeasure(std::vector<T *> &ele, double &gamma, double &gammaMin,
+GetQualityMeasure(GEntity *ge, int familyType, double &gamma, double &gammaMin,
                   double &gammaMax, double &minSICN, double &minSICNMin,
                   double &minSICNMax, double &minSIGE, double &minSIGEMin,
                   double &minSIGEMax, double quality[3][100])
 {
-  for(std::size_t i = 0; i < ele.size(); i++) {
-    double g = ele[i]->gammaShapeMeasure();
+  if(!ge->getNumMeshElementsByType(familyType)) return;
+  // the measures are computed in parallel and cached on the entity
+  const std::vector<double> &gv = ge->getMeshElementQualities(
+    familyType, MElement::getQualityMeasureIndex("gamma"));
+  const std::vector<double> &sv = ge->getMeshElementQualities(
+    familyType, MElement::getQualityMeasureIndex("minSICN"));
+  const std::vector<double> &ev = ge->getMeshElementQualities(
+    familyType, MElement::getQualityMeasureIndex("minSIGE"));
+  for(std::size_t i = 0; i < gv.size(); i++) {
+    double g = gv[i];
     gamma += g;
     gammaMin = std::min(gammaMin, g);
     gammaMax = std::max(gammaMax, g);
-    double s = ele[i]->minSICNShapeMeasure();
+    double s = sv[i];
     minSICN += s;
     minSICNMin = std::min(minSICNMin, s);
     minSICNMax = std::max(minSICNMax, s);
-    double e = ele[i]->minSIGEShapeMeasure();
+    double e = ev[i];
     minSIGE += e;
     minSIGEMin = std::min(minSIGEMin, e);
     minSIGEMax = std::max(minSIGEMax, e);
-    for(int j = 0; j < 100; j++) {
-      if(s > (2 * j - 100) / 100. && s <= (2 * j - 98) / 100.) quality[0][j]++;
-      if(g > j / 100. && g <= (j + 1) / 100.) quality[1][j]++;
-      if(e > (2 * j - 100) / 100. && e <= (2 * j - 98) / 100.) quality[2][j]++;
-    }
+    AddToHistogram(s, -1, 1, quality[0]);
+    AddToHistogram(g, 0, 1, quality[1]);
+    AddToHistogram(e, -1, 1, quality[2]);
   }
 }
 
@@ -243,16 +263,16 @@ void GetStatistics(double stat[50], double quality[3][100], bool visibleOnly)
     if(N) { // if we have 3D elements
       for(auto it = m->firstRegion(); it != m->lastRegion(); ++it) {
         if(visibleOnly && !(*it)->getVisibility()) continue;
-        GetQualityMeasure((*it)->tetrahedra, gamma, gammaMin, gammaMax, minSICN,
+        GetQualityMeasure(*it, TYPE_TET, gamma, gammaMin, gammaMax, minSICN,
                           minSICNMin, minSICNMax, minSIGE, minSIGEMin,
                           minSIGEMax, quality);
-        GetQualityMeasure((*it)->hexahedra, gamma, gammaMin, gammaMax, minSICN,
+        GetQualityMeasure(*it, TYPE_HEX, gamma, gammaMin, gammaMax, minSICN,
                           minSICNMin, minSICNMax, minSIGE, minSIGEMin,
                           minSIGEMax, quality);
-        GetQualityMeasure((*it)->prisms, gamma, gammaMin, gammaMax, minSICN,
+        GetQualityMeasure(*it, TYPE_PRI, gamma, gammaMin, gammaMax, minSICN,
                           minSICNMin, minSICNMax, minSIGE, minSIGEMin,
                           minSIGEMax, quality);
-        GetQualityMeasure((*it)->pyramids, gamma, gammaMin, gammaMax, minSICN,
+        GetQualityMeasure(*it, TYPE_PYR, gamma, gammaMin, gammaMax, minSICN,
                           minSICNMin, minSICNMax, minSIGE, minSIGEMin,
                           minSIGEMax, quality);
       }
@@ -261,10 +281,10 @@ void GetStatistics(double stat[50], double quality[3][100], bool visibleOnly)
       N = stat[7] + stat[8];
       for(auto it = m->firstFace(); it != m->lastFace(); ++it) {
         if(visibleOnly && !(*it)->getVisibility()) continue;
-        GetQualityMeasure((*it)->quadrangles, gamma, gammaMin, gammaMax,
-                          minSICN, minSICNMin, minSICNMax, minSIGE, minSIGEMin,
+        GetQualityMeasure(*it, TYPE_QUA, gamma, gammaMin, gammaMax, minSICN,
+                          minSICNMin, minSICNMax, minSIGE, minSIGEMin,
                           minSIGEMax, quality);
-        GetQualityMeasure((*it)->triangles, gamma, gammaMin, gammaMax, minSICN,
+        GetQualityMeasure(*it, TYPE_TRI, gamma, gammaMin, gammaMax, minSICN,
                           minSICNMin, minSICNMax, minSIGE, minSIGEMin,
                           minSIGEMax, quality);
       }
@@ -1011,6 +1031,10 @@ void OptimizeMesh(GModel *m, const std::string &how, bool force, int niter)
     std::for_each(m->firstRegion(), m->lastRegion(),
                   EmbeddedCompatibilityTest());
 
+  // nodes have been moved: invalidate the cached data computed from the mesh
+  // (e.g. the element quality measures)
+  m->invalidateMeshDataCaches();
+
   double t2 = Cpu(), w2 = TimeOfDay();
   Msg::StatusBar(true, "Done optimizing mesh (Wall %gs, CPU %gs)", w2 - w1,
                  t2 - t1);
@@ -1341,6 +1365,10 @@ void GenerateMesh(GModel *m, int ask)
   m->clearLastMeshEntityError();
   m->clearLastMeshVertexError();
 
+  // report the projection cache statistics of this run only
+  for(auto it = m->firstFace(); it != m->lastFace(); ++it)
+    (*it)->resetProjectionStatistics();
+
   // Initialize pseudo random mesh generator with the same seed
   srand(CTX::instance()->mesh.randomSeed);
 
@@ -1477,6 +1505,21 @@ void GenerateMesh(GModel *m, int ask)
   Msg::Info("%d nodes %d elements", m->getNumMeshVertices(),
             m->getNumMeshElements());
 
+  if(CTX::instance()->geom.projectionCacheSize > 0) {
+    std::size_t queries = 0, hits = 0, iterations = 0;
+    for(auto it = m->firstFace(); it != m->lastFace(); ++it) {
+      std::size_t q, h, i;
+      (*it)->getProjectionStatistics(q, h, i);
+      queries += q;
+      hits += h;
+      iterations += i;
+    }
+    if(queries)
+      Msg::Info("Projection cache: %lu projections, %lu converged from "
+                "cached initial guess, %g Newton iterations per projection",
+                queries, hits, (double)iterations / queries);
+  }
+
   Msg::PrintErrorCounter("Mesh generation error summary");
 
   if(qqs != nullptr) delete qqs;
@@ -3,6 +3,7 @@
 // See the LICENSE.txt file in the Gmsh root directory for license information.
 // Please report all issues on https://gitlab.onelab.info/gmsh/gmsh/issues.
 
+#include <stdexcept>
 #include "GmshConfig.h"
 #include "GModel.h"
 #include "discreteEdge.h"
@@ -10,6 +11,7 @@
 #include "GEdge.h"
 #include "MLine.h"
 #include "BackgroundMeshTools.h"
+#include "ExtrudeParams.h"
 #include "boundaryLayersData.h"
 #include "Numeric.h"
 #include "GmshMessage.h"
@@ -246,12 +248,18 @@ static double trapezoidal(IntPoint *const P1, IntPoint *const P2)
   return 0.5 * (P1->lc + P2->lc) * (P2->t - P1->t);
 }
 
+// the recursive integration always bisects the interval at least this number
+// of times before checking the error
+static const int integrationMinDepth = 6;
+
+// store in the p field of the new points the increment of the primitive: the
+// primitive is accumulated afterwards, in order, by Integration()
 template <typename function>
 static void RecursiveIntegration(GEdge *ge, IntPoint *from, IntPoint *to,
                                  function f, std::vector<IntPoint> &Points,
                                  double Prec, int *depth)
 {
-  IntPoint P, p1;
+  IntPoint P;
 
   (*depth)++;
 
@@ -263,13 +271,11 @@ static void RecursiveIntegration(GEdge *ge, IntPoint *from, IntPoint *to,
   double const val3 = trapezoidal(&P, to);
   double const err = std::abs(val1 - val2 - val3);
 
-  if(((err < Prec) && (*depth > 6)) || (*depth > 25)) {
-    p1 = Points.back();
-    P.p = p1.p + val2;
+  if(((err < Prec) && (*depth > integrationMinDepth)) || (*depth > 25)) {
+    P.p = val2;
     Points.push_back(P);
 
-    p1 = Points.back();
-    to->p = p1.p + val3;
+    to->p = val3;
     Points.push_back(*to);
   }
   else {
@@ -280,23 +286,94 @@ static void RecursiveIntegration(GEdge *ge, IntPoint *from, IntPoint *to,
   (*depth)--;
 }
 
+// execute f(i) for 0 <= i < n in parallel. When called from a parallel
+// region, e.g. from the parallel loop over the curves in Mesh1D (in which case
+// the number of threads has already been set following the same rules as
+// below, and nested parallelism is disabled), tasks are created instead: they
+// are executed by the threads of the enclosing region once they are done with
+// their own work, so that a single long curve does not serialize the meshing
+template <typename F>
+static void parallelForSubIntervals(GEdge *ge, int n, F f)
+{
+  bool exceptions = false;
+  if(Msg::GetParallelLevel() > 0) {
+#pragma omp taskloop grainsize(1) shared(exceptions)
+    for(int i = 0; i < n; i++) {
+      if(exceptions) continue;
+      try { // OpenMP forbids leaving block via exception
+        f(i);
+      }
+      catch(...) {
+        exceptions = true;
+      }
+    }
+  }
+  else {
+    int nthreads = CTX::instance()->numThreads;
+    if(CTX::instance()->mesh.maxNumThreads1D > 0)
+      nthreads = CTX::instance()->mesh.maxNumThreads1D;
+    if(!nthreads) nthreads = Msg::GetMaxThreads();
+    // boundary layers and extruded meshes are not yet thread-safe
+    if(ge->model()->getFields()->getNumBoundaryLayerFields()) nthreads = 1;
+    if(ge->meshAttributes.extrude &&
+       ge->meshAttributes.extrude->mesh.ExtrudeMesh)
+      nthreads = 1;
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+    for(int i = 0; i < n; i++) {
+      if(exceptions) continue;
+      try { // OpenMP forbids leaving block via exception
+        f(i);
+      }
+      catch(...) {
+        exceptions = true;
+      }
+    }
+  }
+  if(exceptions) throw std::runtime_error(Msg::GetLastError());
+}
+
 template <typename function>
 static double Integration(GEdge *ge, double t1, double t2, function f,
                           std::vector<IntPoint> &Points, double Prec)
 {
-  IntPoint from, to;
-
-  int depth = 0;
-
-  from.t = t1;
-  from.lc = f(ge, from.t);
-  from.p = 0.0;
-  Points.push_back(from);
-
-  to.t = t2;
-  to.lc = f(ge, to.t);
-
-  RecursiveIntegration(ge, &from, &to, f, Points, Prec, &depth);
+  // the first levels of the recursion are unconditional: create the
+  // corresponding sub-intervals directly (with the same bisection, so that the
+  // result does not depend on the number of threads), and integrate them
+  // concurrently, as a single curve can require a very large number of
+  // evaluations of the mesh size
+  const int numSub = 1 << integrationMinDepth;
+  std::vector<IntPoint> ends(numSub + 1);
+  ends[0].t = t1;
+  ends[numSub].t = t2;
+  for(int step = numSub; step > 1; step /= 2) {
+    for(int i = 0; i < numSub; i += step)
+      ends[i + step / 2].t = 0.5 * (ends[i].t + ends[i + step].t);
+  }
+
+  parallelForSubIntervals(ge, numSub + 1,
+                          [&](int i) { ends[i].lc = f(ge, ends[i].t); });
+
+  std::vector<std::vector<IntPoint> > subPoints(numSub);
+  parallelForSubIntervals(ge, numSub, [&](int i) {
+    IntPoint from = ends[i], to = ends[i + 1];
+    int depth = integrationMinDepth;
+    RecursiveIntegration(ge, &from, &to, f, subPoints[i], Prec, &depth);
+  });
+
+  // concatenate the points and compute the primitive
+  std::size_t num = 1;
+  for(int i = 0; i < numSub; i++) num += subPoints[i].size();
+  Points.reserve(Points.size() + num);
+  ends[0].p = 0.0;
+  Points.push_back(ends[0]);
+  for(int i = 0; i < numSub; i++) {
+    for(std::size_t j = 0; j < subPoints[i].size(); j++) {
+      IntPoint P = subPoints[i][j];
+      P.p += Points.back().p;
+      Points.push_back(P);
+    }
+    std::vector<IntPoint>().swap(subPoints[i]);
+  }
 
   return Points.back().p;
 }
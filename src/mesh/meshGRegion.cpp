@@ -158,6 +158,7 @@ void MeshDelaunayVolume(std::vector<GRegion *> &regions)
               compareMTriangleLexicographic());
     ++itf;
   }
+  gr->model()->invalidateMeshDataCaches();
 
   // restore set of faces and embedded edges/vertices
   if(CTX::instance()->mesh.compoundClassify == 0) {
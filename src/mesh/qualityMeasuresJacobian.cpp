@@ -4,6 +4,7 @@
 // Please report all issues on https://gitlab.onelab.info/gmsh/gmsh/issues.
 
 #include <limits>
+#include <map>
 #include "qualityMeasuresJacobian.h"
 #include "FuncSpaceData.h"
 #include "MElement.h"
@@ -12,6 +13,8 @@
 #include "JacobianBasis.h"
 #include "Numeric.h"
 #include "fullMatrix.h"
+#include "Context.h"
+#include "GmshMessage.h"
 
 // For regression tests:
 #include "GModel.h"
@@ -239,6 +242,42 @@ static bool _getQualityFunctionSpace(MElement *el, FuncSpaceData &fsGrad,
 
 namespace jacobianBasedQuality {
 
+  static int _getNumThreads()
+  {
+    int nthreads = CTX::instance()->numThreads;
+    if(!nthreads) nthreads = Msg::GetMaxThreads();
+    return nthreads;
+  }
+
+  // Bezier-based extrema of the Jacobian determinant from its sampled values
+  // (the memory pools of bezierCoeff are not thread-safe: usePools should be
+  // false when called concurrently)
+  static void _minMaxJacobianDeterminant(const JacobianBasis *jfs,
+                                         const fullVector<double> &coeffLag,
+                                         double &min, double &max, bool debug,
+                                         bool usePools = true)
+  {
+    // Convert into Bezier coeff
+    if(usePools)
+      bezierCoeff::usePools(static_cast<std::size_t>(coeffLag.size()), 0);
+    bezierCoeff *bez =
+      new bezierCoeff(jfs->getFuncSpaceData(), coeffLag, usePools ? 0 : -1);
+
+    // Refine coefficients
+    std::vector<_coeffData *> domains(1, new _coeffDataJac(bez));
+    _subdivideDomains(domains, true, debug);
+
+    // Get extrema
+    min = std::numeric_limits<double>::max();
+    max = -min;
+    for(std::size_t i = 0; i < domains.size(); ++i) {
+      min = std::min(min, domains[i]->minB());
+      max = std::max(max, domains[i]->maxB());
+      domains[i]->deleteBezierCoeff();
+      delete domains[i];
+    }
+  }
+
   void minMaxJacobianDeterminant(MElement *el, double &min, double &max,
                                  const fullMatrix<double> *normals, bool debug)
   {
@@ -258,36 +297,90 @@ namespace jacobianBasedQuality {
     el->getNodesCoord(nodesXYZ);
     jfs->getSignedJacobian(nodesXYZ, coeffLag, normals);
 
-    // Convert into Bezier coeff
-    bezierCoeff::usePools(static_cast<std::size_t>(coeffLag.size()), 0);
-    bezierCoeff *bez = new bezierCoeff(jfs->getFuncSpaceData(), coeffLag, 0);
+    _minMaxJacobianDeterminant(jfs, coeffLag, min, max, debug);
+  }
 
-    // Refine coefficients
-    std::vector<_coeffData *> domains(1, new _coeffDataJac(bez));
-    _subdivideDomains(domains, true, debug);
+  void minMaxJacobianDeterminant(const std::vector<MElement *> &el,
+                                 std::vector<double> &min,
+                                 std::vector<double> &max,
+                                 const fullMatrix<double> *normals)
+  {
+    min.resize(el.size());
+    max.resize(el.size());
+
+    std::map<int, std::vector<std::size_t> > types;
+    for(std::size_t i = 0; i < el.size(); ++i)
+      types[el[i]->getTypeForMSH()].push_back(i);
+
+    for(auto it = types.begin(); it != types.end(); ++it) {
+      const std::vector<std::size_t> &idx = it->second;
+      MElement *el0 = el[idx[0]];
+      const JacobianBasis *jfs = el0->getJacobianFuncSpace();
+      if(!jfs) {
+        Msg::Warning("Jacobian function space not implemented for %s",
+                     el0->getName().c_str());
+        for(std::size_t i = 0; i < idx.size(); ++i) {
+          min[idx[i]] = 99;
+          max[idx[i]] = -99;
+        }
+        continue;
+      }
 
-    // Get extrema
-    min = std::numeric_limits<double>::max();
-    max = -min;
-    for(std::size_t i = 0; i < domains.size(); ++i) {
-      min = std::min(min, domains[i]->minB());
-      max = std::max(max, domains[i]->maxB());
-      domains[i]->deleteBezierCoeff();
-      delete domains[i];
+      // Sample jacobian determinant of all the elements (with the same nodes
+      // as MElement::getNodesCoord(), which differ from the element vertices
+      // e.g. for cut elements)
+      const int numNodes = jfs->getNumMapNodes();
+      const int numEl = static_cast<int>(idx.size());
+      fullMatrix<double> nodesX(numNodes, numEl), nodesY(numNodes, numEl),
+        nodesZ(numNodes, numEl);
+      for(int j = 0; j < numEl; ++j) {
+        MElement *e = el[idx[j]];
+        for(int k = 0; k < numNodes; ++k) {
+          const MVertex *v = e->getShapeFunctionNode(k);
+          nodesX(k, j) = v->x();
+          nodesY(k, j) = v->y();
+          nodesZ(k, j) = v->z();
+        }
+      }
+      fullMatrix<double> coeffLag(jfs->getNumSamplingPnts(), numEl);
+      jfs->getSignedJacobian(nodesX, nodesY, nodesZ, coeffLag, normals);
+
+      // Convert the samples of all the elements into Bezier coefficients at
+      // once, then only subdivide the elements whose bounds are not sharp
+      // enough
+      const bezierCoeff bez(jfs->getFuncSpaceData(), coeffLag);
+      const int numCorner = bez.getNumCornerCoeff();
+      const int numCoeff = bez.getNumCoeff();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(_getNumThreads())
+      for(int j = 0; j < numEl; ++j) {
+        double minL = bez.getCornerCoeff(0, j), maxL = minL;
+        for(int k = 1; k < numCorner; ++k) {
+          minL = std::min(minL, bez.getCornerCoeff(k, j));
+          maxL = std::max(maxL, bez.getCornerCoeff(k, j));
+        }
+        double minB = bez(0, j), maxB = minB;
+        for(int k = 1; k < numCoeff; ++k) {
+          minB = std::min(minB, bez(k, j));
+          maxB = std::max(maxB, bez(k, j));
+        }
+        if(_coeffDataJac::boundsOk(minL, maxL, minB, maxB)) {
+          min[idx[j]] = minB;
+          max[idx[j]] = maxB;
+        }
+        else {
+          fullVector<double> coeffLagEl(coeffLag.size1());
+          for(int k = 0; k < coeffLag.size1(); ++k)
+            coeffLagEl(k) = coeffLag(k, j);
+          _minMaxJacobianDeterminant(jfs, coeffLagEl, min[idx[j]], max[idx[j]],
+                                     false, false);
+        }
+      }
     }
   }
 
-  double minIGEMeasure(MElement *el, bool knownValid, bool reversedOk,
-                       const fullMatrix<double> *normals, bool debug)
+  static double _minIGEMeasure(MElement *el, const fullMatrix<double> *normals,
+                               bool debug, bool usePools)
   {
-    if(!knownValid) {
-      // Computation of the measure should never be performed to invalid
-      // elements (for which the measure is 0).
-      double jmin, jmax;
-      minMaxJacobianDeterminant(el, jmin, jmax, normals);
-      if((jmin <= 0 && jmax >= 0) || (jmax < 0 && !reversedOk)) return 0;
-    }
-
     // Get Jacobian and gradient bases
     const GradientBasis *gradBasis;
     const JacobianBasis *jacBasis;
@@ -309,11 +402,14 @@ namespace jacobianBasedQuality {
     if(el->getDim() == 2) coeffMatLag.resize(coeffMatLag.size1(), 6, false);
 
     // Convert into Bezier coeff
-    bezierCoeff::usePools(static_cast<std::size_t>(coeffDetLag.size()),
-                          static_cast<std::size_t>(coeffMatLag.size1()) *
-                            static_cast<std::size_t>(coeffMatLag.size2()));
-    bezierCoeff *bezDet = new bezierCoeff(jacDetSpace, coeffDetLag, 0);
-    bezierCoeff *bezMat = new bezierCoeff(jacMatSpace, coeffMatLag, 1);
+    if(usePools)
+      bezierCoeff::usePools(static_cast<std::size_t>(coeffDetLag.size()),
+                            static_cast<std::size_t>(coeffMatLag.size1()) *
+                              static_cast<std::size_t>(coeffMatLag.size2()));
+    bezierCoeff *bezDet =
+      new bezierCoeff(jacDetSpace, coeffDetLag, usePools ? 0 : -1);
+    bezierCoeff *bezMat =
+      new bezierCoeff(jacMatSpace, coeffMatLag, usePools ? 1 : -1);
 
     // Compute measure and refine
     std::vector<_coeffData *> domains;
@@ -323,17 +419,9 @@ namespace jacobianBasedQuality {
     return _getMinAndDeleteDomains(domains);
   }
 
-  double minICNMeasure(MElement *el, bool knownValid, bool reversedOk,
-                       const fullMatrix<double> *normals, bool debug)
+  static double _minICNMeasure(MElement *el, const fullMatrix<double> *normals,
+                               bool debug, bool usePools)
   {
-    if(!knownValid) {
-      // Computation of the measure should never
-      // be performed to invalid elements (for which the measure is 0).
-      double jmin, jmax;
-      minMaxJacobianDeterminant(el, jmin, jmax, normals);
-      if((jmin <= 0 && jmax >= 0) || (jmax < 0 && !reversedOk)) return 0;
-    }
-
     // Get Jacobian and gradient bases
     const GradientBasis *gradBasis;
     const JacobianBasis *jacBasis;
@@ -355,11 +443,14 @@ namespace jacobianBasedQuality {
     if(el->getDim() == 2) coeffMatLag.resize(coeffMatLag.size1(), 6, false);
 
     // Convert into Bezier coeff
-    bezierCoeff::usePools(static_cast<std::size_t>(coeffDetLag.size()),
-                          static_cast<std::size_t>(coeffMatLag.size1()) *
-                            static_cast<std::size_t>(coeffMatLag.size2()));
-    bezierCoeff *bezDet = new bezierCoeff(jacDetSpace, coeffDetLag, 0);
-    bezierCoeff *bezMat = new bezierCoeff(jacMatSpace, coeffMatLag, 1);
+    if(usePools)
+      bezierCoeff::usePools(static_cast<std::size_t>(coeffDetLag.size()),
+                            static_cast<std::size_t>(coeffMatLag.size1()) *
+                              static_cast<std::size_t>(coeffMatLag.size2()));
+    bezierCoeff *bezDet =
+      new bezierCoeff(jacDetSpace, coeffDetLag, usePools ? 0 : -1);
+    bezierCoeff *bezMat =
+      new bezierCoeff(jacMatSpace, coeffMatLag, usePools ? 1 : -1);
 
     // Compute measure and refine
     std::vector<_coeffData *> domains;
@@ -369,6 +460,67 @@ namespace jacobianBasedQuality {
     return _getMinAndDeleteDomains(domains);
   }
 
+  // Computation of the measures should never be performed to invalid elements
+  // (for which the measure is 0)
+  static bool _isInvalid(double jmin, double jmax, bool reversedOk)
+  {
+    return (jmin <= 0 && jmax >= 0) || (jmax < 0 && !reversedOk);
+  }
+
+  double minIGEMeasure(MElement *el, bool knownValid, bool reversedOk,
+                       const fullMatrix<double> *normals, bool debug)
+  {
+    if(!knownValid) {
+      double jmin, jmax;
+      minMaxJacobianDeterminant(el, jmin, jmax, normals);
+      if(_isInvalid(jmin, jmax, reversedOk)) return 0;
+    }
+    return _minIGEMeasure(el, normals, debug, true);
+  }
+
+  double minICNMeasure(MElement *el, bool knownValid, bool reversedOk,
+                       const fullMatrix<double> *normals, bool debug)
+  {
+    if(!knownValid) {
+      double jmin, jmax;
+      minMaxJacobianDeterminant(el, jmin, jmax, normals);
+      if(_isInvalid(jmin, jmax, reversedOk)) return 0;
+    }
+    return _minICNMeasure(el, normals, debug, true);
+  }
+
+  void minIGEMeasure(const std::vector<MElement *> &el,
+                     std::vector<double> &ige, bool knownValid,
+                     bool reversedOk, const fullMatrix<double> *normals)
+  {
+    ige.resize(el.size());
+    std::vector<double> jmin, jmax;
+    if(!knownValid) minMaxJacobianDeterminant(el, jmin, jmax, normals);
+#pragma omp parallel for schedule(dynamic, 16) num_threads(_getNumThreads())
+    for(int i = 0; i < (int)el.size(); ++i) {
+      if(!knownValid && _isInvalid(jmin[i], jmax[i], reversedOk))
+        ige[i] = 0;
+      else
+        ige[i] = _minIGEMeasure(el[i], normals, false, false);
+    }
+  }
+
+  void minICNMeasure(const std::vector<MElement *> &el,
+                     std::vector<double> &icn, bool knownValid,
+                     bool reversedOk, const fullMatrix<double> *normals)
+  {
+    icn.resize(el.size());
+    std::vector<double> jmin, jmax;
+    if(!knownValid) minMaxJacobianDeterminant(el, jmin, jmax, normals);
+#pragma omp parallel for schedule(dynamic, 16) num_threads(_getNumThreads())
+    for(int i = 0; i < (int)el.size(); ++i) {
+      if(!knownValid && _isInvalid(jmin[i], jmax[i], reversedOk))
+        icn[i] = 0;
+      else
+        icn[i] = _minICNMeasure(el[i], normals, false, false);
+    }
+  }
+
   void sampleJacobianDeterminant(MElement *el, int deg, double &min,
                                  double &max, const fullMatrix<double> *normals)
   {
@@ -508,10 +660,16 @@ namespace jacobianBasedQuality {
   }
 
   bool _coeffDataJac::boundsOk(double minL, double maxL) const
+  {
+    return boundsOk(minL, maxL, _minB, _maxB);
+  }
+
+  bool _coeffDataJac::boundsOk(double minL, double maxL, double minB,
+                               double maxB)
   {
     double tol = std::max(std::abs(minL), std::abs(maxL)) * 1e-3;
-    return (minL <= 0 || _minB > 0) && (maxL >= 0 || _maxB < 0) &&
-           minL - _minB < tol && _maxB - maxL < tol;
+    return (minL <= 0 || minB > 0) && (maxL >= 0 || maxB < 0) &&
+           minL - minB < tol && maxB - maxL < tol;
     // NB: First condition implies minL and minB both positive or both negative
   }
 
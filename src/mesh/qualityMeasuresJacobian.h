@@ -19,6 +19,14 @@ namespace jacobianBasedQuality {
   void minMaxJacobianDeterminant(MElement *el, double &min, double &max,
                                  const fullMatrix<double> *normals = nullptr,
                                  bool debug = false);
+  // Same as above for a block of elements: the Jacobian determinant of all
+  // the elements of the same type is sampled and converted into Bezier
+  // coefficients at once, with one matrix product per coordinate; only the
+  // elements with inconclusive bounds are then subdivided, in parallel
+  void minMaxJacobianDeterminant(const std::vector<MElement *> &el,
+                                 std::vector<double> &min,
+                                 std::vector<double> &max,
+                                 const fullMatrix<double> *normals = nullptr);
   double minIGEMeasure(MElement *el, bool knownValid = false,
                        bool reversedOk = false,
                        const fullMatrix<double> *normals = nullptr,
@@ -27,6 +35,15 @@ namespace jacobianBasedQuality {
                        bool reversedOk = false,
                        const fullMatrix<double> *normals = nullptr,
                        bool debug = false);
+  // Same as above for blocks of elements, computed in parallel
+  void minIGEMeasure(const std::vector<MElement *> &el,
+                     std::vector<double> &ige, bool knownValid = false,
+                     bool reversedOk = false,
+                     const fullMatrix<double> *normals = nullptr);
+  void minICNMeasure(const std::vector<MElement *> &el,
+                     std::vector<double> &icn, bool knownValid = false,
+                     bool reversedOk = false,
+                     const fullMatrix<double> *normals = nullptr);
   void sampleJacobianDeterminant(MElement *el, int order, double &min,
                                  double &max,
                                  const fullMatrix<double> *normals = nullptr);
@@ -78,6 +95,7 @@ namespace jacobianBasedQuality {
     ~_coeffDataJac() {}
 
     bool boundsOk(double minL, double maxL) const;
+    static bool boundsOk(double minL, double maxL, double minB, double maxB);
     void getSubCoeff(std::vector<_coeffData *> &) const;
     void deleteBezierCoeff();
   };
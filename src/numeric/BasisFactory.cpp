@@ -11,28 +11,113 @@
 #include "miniBasis.h"
 #include "CondNumBasis.h"
 #include "JacobianBasis.h"
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <cstddef>
 
-std::map<int, nodalBasis *> BasisFactory::fs;
-std::map<int, CondNumBasis *> BasisFactory::cs;
-std::map<FuncSpaceData, JacobianBasis *> BasisFactory::js;
-std::map<FuncSpaceData, bezierBasis *> BasisFactory::bs;
-std::map<FuncSpaceData, GradientBasis *> BasisFactory::gs;
+namespace {
+
+  // Index of the bases in the flat tables: element types for nodal and
+  // condition number bases, and function spaces up to order maxOrder - 1 for
+  // the others (other function spaces are stored in a map).
+  const int maxOrder = 32;
+
+  int tableIndex(int tag)
+  {
+    return (tag >= 0 && tag <= MSH_MAX_NUM) ? tag : -1;
+  }
+
+  int tableIndex(const FuncSpaceData &data)
+  {
+    const int type = data.getType(), order = data.getSpaceOrder();
+    const int nij = data.getNij(), nk = data.getNk();
+    if(type < 0 || type > TYPE_MAX_NUM) return -1;
+    if(type != TYPE_PYR) {
+      if(nij != 0 || nk != order || data.getPyramidalSpace()) return -1;
+      if(order < 0 || order >= maxOrder) return -1;
+      return type * maxOrder + order;
+    }
+    const bool pyr = data.getPyramidalSpace();
+    if(nij < 0 || nij >= maxOrder || nk < 0 || nk >= maxOrder) return -1;
+    if(order != (pyr ? nij + nk : std::max(nij, nk))) return -1;
+    return (TYPE_MAX_NUM + 1) * maxOrder +
+           ((pyr ? 1 : 0) * maxOrder + nij) * maxOrder + nk;
+  }
+
+  // Bases are created once and never modified: existing bases are looked up
+  // in a flat table of atomic pointers, without any lock. A new basis is
+  // created outside of any critical section (its constructor can itself
+  // request other bases), and published with a compare-and-swap; if another
+  // thread published the same basis in the meantime, ours is discarded.
+  template <class Key, class T, int N> class basisTable {
+  private:
+    std::atomic<T *> _flat[N];
+    std::map<Key, T *> _other;
+
+  public:
+    basisTable()
+    {
+      for(int i = 0; i < N; i++) _flat[i].store(nullptr);
+    }
+    template <class F> T *get(const Key &key, F create)
+    {
+      const int i = tableIndex(key);
+      if(i >= 0) {
+        T *b = _flat[i].load(std::memory_order_acquire);
+        if(b) return b;
+        T *n = create();
+        if(!n) return nullptr;
+        if(_flat[i].compare_exchange_strong(b, n, std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+          return n;
+        delete n;
+        return b;
+      }
+      T *b = nullptr;
+#pragma omp critical(BasisFactoryTable)
+      {
+        auto it = _other.find(key);
+        if(it != _other.end()) b = it->second;
+      }
+      if(b) return b;
+      T *n = create();
+      if(!n) return nullptr;
+#pragma omp critical(BasisFactoryTable)
+      {
+        auto it = _other.insert(std::make_pair(key, n));
+        b = it.first->second;
+      }
+      if(b != n) delete n;
+      return b;
+    }
+    void clear()
+    {
+      for(int i = 0; i < N; i++) delete _flat[i].exchange(nullptr);
+      for(auto it = _other.begin(); it != _other.end(); it++)
+        delete it->second;
+      _other.clear();
+    }
+  };
+
+  const int numTags = MSH_MAX_NUM + 1;
+  const int numSpaces =
+    (TYPE_MAX_NUM + 1) * maxOrder + 2 * maxOrder * maxOrder;
+
+  basisTable<int, nodalBasis, numTags> fs;
+  basisTable<int, CondNumBasis, numTags> cs;
+  basisTable<FuncSpaceData, JacobianBasis, numSpaces> js;
+  basisTable<FuncSpaceData, bezierBasis, numSpaces> bs;
+  basisTable<FuncSpaceData, GradientBasis, numSpaces> gs;
+
+} // namespace
 
 const nodalBasis *BasisFactory::getNodalBasis(int tag)
 {
-  // If the Basis has already been built, return it.
-  auto it = fs.find(tag);
-  if(it != fs.end()) { return it->second; }
-  // Get the parent type to see which kind of basis
-  // we want to create
-  nodalBasis *F = nullptr;
-  if(tag == MSH_TRI_MINI)
-    F = new miniBasisTri();
-  else if(tag == MSH_TET_MINI)
-    F = new miniBasisTet();
-  else {
+  return fs.get(tag, [tag]() -> nodalBasis * {
+    // Get the parent type to see which kind of basis we want to create
+    if(tag == MSH_TRI_MINI) return new miniBasisTri();
+    if(tag == MSH_TET_MINI) return new miniBasisTet();
     int parentType = ElementType::getParentType(tag);
     switch(parentType) {
     case(TYPE_PNT):
@@ -41,34 +126,19 @@ const nodalBasis *BasisFactory::getNodalBasis(int tag)
     case(TYPE_QUA):
     case(TYPE_PRI):
     case(TYPE_TET):
-    case(TYPE_HEX): F = new polynomialBasis(tag); break;
-    case(TYPE_PYR): F = new pyramidalBasis(tag); break;
+    case(TYPE_HEX): return new polynomialBasis(tag);
+    case(TYPE_PYR): return new pyramidalBasis(tag);
     default:
       Msg::Error("Unknown type of element %d (in BasisFactory)", tag);
       return nullptr;
     }
-  }
-
-  std::pair<std::map<int, nodalBasis *>::const_iterator, bool> inserted;
-#pragma omp critical
-  {
-    inserted = fs.insert(std::make_pair(tag, F));
-    if(!inserted.second) delete F;
-  }
-
-  return inserted.first->second;
+  });
 }
 
 const JacobianBasis *BasisFactory::getJacobianBasis(int tag, FuncSpaceData fsd)
 {
   FuncSpaceData data = fsd.getForNonSerendipitySpace();
-
-  auto it = js.find(data);
-  if(it != js.end()) return it->second;
-
-  JacobianBasis *J = new JacobianBasis(tag, data);
-  js.insert(std::make_pair(data, J));
-  return J;
+  return js.get(data, [tag, &data]() { return new JacobianBasis(tag, data); });
 }
 
 const JacobianBasis *BasisFactory::getJacobianBasis(int tag, int order)
@@ -94,24 +164,14 @@ const JacobianBasis *BasisFactory::getJacobianBasis(int tag)
 
 const CondNumBasis *BasisFactory::getCondNumBasis(int tag, int cnOrder)
 {
-  auto it = cs.find(tag);
-  if(it != cs.end()) return it->second;
-
-  CondNumBasis *M = new CondNumBasis(tag, cnOrder);
-  cs.insert(std::make_pair(tag, M));
-  return M;
+  return cs.get(tag,
+                [tag, cnOrder]() { return new CondNumBasis(tag, cnOrder); });
 }
 
 const GradientBasis *BasisFactory::getGradientBasis(int tag, FuncSpaceData fsd)
 {
   FuncSpaceData data = fsd.getForNonSerendipitySpace();
-
-  auto it = gs.find(data);
-  if(it != gs.end()) return it->second;
-
-  GradientBasis *G = new GradientBasis(tag, data);
-  gs.insert(std::make_pair(data, G));
-  return G;
+  return gs.get(data, [tag, &data]() { return new GradientBasis(tag, data); });
 }
 
 const GradientBasis *BasisFactory::getGradientBasis(int tag, int order)
@@ -128,13 +188,7 @@ const GradientBasis *BasisFactory::getGradientBasis(int tag)
 const bezierBasis *BasisFactory::getBezierBasis(FuncSpaceData fsd)
 {
   FuncSpaceData data = fsd.getForNonSerendipitySpace();
-
-  auto it = bs.find(data);
-  if(it != bs.end()) return it->second;
-
-  bezierBasis *B = new bezierBasis(data);
-  bs.insert(std::make_pair(data, B));
-  return B;
+  return bs.get(data, [&data]() { return new bezierBasis(data); });
 }
 
 const bezierBasis *BasisFactory::getBezierBasis(int parentType, int order)
@@ -149,38 +203,9 @@ const bezierBasis *BasisFactory::getBezierBasis(int tag)
 
 void BasisFactory::clearAll()
 {
-  auto itF = fs.begin();
-  while(itF != fs.end()) {
-    delete itF->second;
-    itF++;
-  }
   fs.clear();
-
-  auto itJ = js.begin();
-  while(itJ != js.end()) {
-    delete itJ->second;
-    itJ++;
-  }
   js.clear();
-
-  auto itC = cs.begin();
-  while(itC != cs.end()) {
-    delete itC->second;
-    itC++;
-  }
   cs.clear();
-
-  auto itG = gs.begin();
-  while(itG != gs.end()) {
-    delete itG->second;
-    itG++;
-  }
   gs.clear();
-
-  auto itB = bs.begin();
-  while(itB != bs.end()) {
-    delete itB->second;
-    itB++;
-  }
   bs.clear();
 }
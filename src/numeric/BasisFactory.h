@@ -15,16 +15,14 @@ class JacobianBasis;
 class FuncSpaceData;
 
 class BasisFactory {
-private:
-  static std::map<int, nodalBasis *> fs;
-  static std::map<int, CondNumBasis *> cs;
-  static std::map<FuncSpaceData, JacobianBasis *> js;
-  static std::map<FuncSpaceData, bezierBasis *> bs;
-  static std::map<FuncSpaceData, GradientBasis *> gs;
-
 public:
   // Caution: the returned pointer can be NULL
 
+  // All the functions below can be called concurrently: looking up a basis
+  // that has already been created is lock-free (see BasisFactory.cpp).
+  // clearAll() should however not be called while other threads use the
+  // factory.
+
   // Nodal
   static const nodalBasis *getNodalBasis(int tag);
 
@@ -611,7 +611,6 @@ void bezierBasisRaiser::computeCoeff(const fullVector<double> &coeffA,
 
 bezierCoeffMemoryPool *bezierCoeff::_pool0 = nullptr;
 bezierCoeffMemoryPool *bezierCoeff::_pool1 = nullptr;
-fullMatrix<double> bezierCoeff::_sub = fullMatrix<double>();
 
 bezierCoeff::bezierCoeff(const FuncSpaceData fsData,
                          const fullMatrix<double> &orderedLagCoeff, int num)
@@ -1252,20 +1251,20 @@ void bezierCoeff::_subdivideQuadrangle(const bezierCoeff &coeff,
   const int n = coeff.getPolynomialOrder() + 1;
   const int N = 2 * n - 1;
   const int dim = coeff._c;
-  _sub.resize(N * N, dim, false);
+  fullMatrix<double> sub(N * N, dim);
   for(int i = 0; i < n; ++i) {
     for(int j = 0; j < n; ++j) {
       const int I1 = i + j * n;
       const int I2 = (2 * i) + (2 * j) * N;
-      for(int k = 0; k < dim; ++k) { _sub(I2, k) = coeff(I1, k); }
+      for(int k = 0; k < dim; ++k) { sub(I2, k) = coeff(I1, k); }
     }
   }
-  for(int i = 0; i < N; i += 2) { _subdivide(_sub, n, i, N); }
-  for(int j = 0; j < N; ++j) { _subdivide(_sub, n, j * N); }
-  _copyQuad(_sub, n, 0, 0, *subCoeff[0]);
-  _copyQuad(_sub, n, n - 1, 0, *subCoeff[1]);
-  _copyQuad(_sub, n, 0, n - 1, *subCoeff[2]);
-  _copyQuad(_sub, n, n - 1, n - 1, *subCoeff[3]);
+  for(int i = 0; i < N; i += 2) { _subdivide(sub, n, i, N); }
+  for(int j = 0; j < N; ++j) { _subdivide(sub, n, j * N); }
+  _copyQuad(sub, n, 0, 0, *subCoeff[0]);
+  _copyQuad(sub, n, n - 1, 0, *subCoeff[1]);
+  _copyQuad(sub, n, 0, n - 1, *subCoeff[2]);
+  _copyQuad(sub, n, n - 1, n - 1, *subCoeff[3]);
   return;
 }
 
@@ -1275,33 +1274,33 @@ void bezierCoeff::_subdivideHexahedron(const bezierCoeff &coeff,
   const int n = coeff.getPolynomialOrder() + 1;
   const int N = 2 * n - 1;
   const int dim = coeff._c;
-  _sub.resize(N * N * N, dim, false);
+  fullMatrix<double> sub(N * N * N, dim);
   for(int i = 0; i < n; ++i) {
     for(int j = 0; j < n; ++j) {
       for(int k = 0; k < n; ++k) {
         const int I1 = i + j * n + k * n * n;
         const int I2 = (2 * i) + (2 * j) * N + (2 * k) * N * N;
-        for(int k = 0; k < dim; ++k) { _sub(I2, k) = coeff(I1, k); }
+        for(int k = 0; k < dim; ++k) { sub(I2, k) = coeff(I1, k); }
       }
     }
   }
   for(int i = 0; i < N; i += 2) {
-    for(int j = 0; j < N; j += 2) { _subdivide(_sub, n, i + j * N, N * N); }
+    for(int j = 0; j < N; j += 2) { _subdivide(sub, n, i + j * N, N * N); }
   }
   for(int i = 0; i < N; i += 2) {
-    for(int k = 0; k < N; ++k) { _subdivide(_sub, n, i + k * N * N, N); }
+    for(int k = 0; k < N; ++k) { _subdivide(sub, n, i + k * N * N, N); }
   }
   for(int j = 0; j < N; ++j) {
-    for(int k = 0; k < N; ++k) { _subdivide(_sub, n, j * N + k * N * N); }
-  }
-  _copyHex(_sub, n, 0, 0, 0, *subCoeff[0]);
-  _copyHex(_sub, n, n - 1, 0, 0, *subCoeff[1]);
-  _copyHex(_sub, n, 0, n - 1, 0, *subCoeff[2]);
-  _copyHex(_sub, n, n - 1, n - 1, 0, *subCoeff[3]);
-  _copyHex(_sub, n, 0, 0, n - 1, *subCoeff[4]);
-  _copyHex(_sub, n, n - 1, 0, n - 1, *subCoeff[5]);
-  _copyHex(_sub, n, 0, n - 1, n - 1, *subCoeff[6]);
-  _copyHex(_sub, n, n - 1, n - 1, n - 1, *subCoeff[7]);
+    for(int k = 0; k < N; ++k) { _subdivide(sub, n, j * N + k * N * N); }
+  }
+  _copyHex(sub, n, 0, 0, 0, *subCoeff[0]);
+  _copyHex(sub, n, n - 1, 0, 0, *subCoeff[1]);
+  _copyHex(sub, n, 0, n - 1, 0, *subCoeff[2]);
+  _copyHex(sub, n, n - 1, n - 1, 0, *subCoeff[3]);
+  _copyHex(sub, n, 0, 0, n - 1, *subCoeff[4]);
+  _copyHex(sub, n, n - 1, 0, n - 1, *subCoeff[5]);
+  _copyHex(sub, n, 0, n - 1, n - 1, *subCoeff[6]);
+  _copyHex(sub, n, n - 1, n - 1, n - 1, *subCoeff[7]);
   return;
 }
 
@@ -1314,15 +1313,15 @@ void bezierCoeff::_subdividePrism(const bezierCoeff &coeff,
   const int dim = coeff._c;
 
   // First, use De Casteljau algorithm in 3rd direction (=> 2 subdomains):
-  _sub.resize(N * ntri, dim, false);
+  fullMatrix<double> sub(N * ntri, dim);
   for(int k = 0; k < n; ++k) {
     for(int i = 0; i < ntri; ++i) {
       const int I1 = i + k * ntri;
       const int I2 = i + (2 * k) * ntri;
-      for(int l = 0; l < dim; ++l) { _sub(I2, l) = coeff(I1, l); }
+      for(int l = 0; l < dim; ++l) { sub(I2, l) = coeff(I1, l); }
     }
   }
-  for(int i = 0; i < ntri; ++i) { _subdivide(_sub, n, i, ntri); }
+  for(int i = 0; i < ntri; ++i) { _subdivide(sub, n, i, ntri); }
 
   // Copy first subdomain into subCoeff[0] and second one into subCoeff2[0]
   std::vector<bezierCoeff *> subCoeff2;
@@ -1330,8 +1329,8 @@ void bezierCoeff::_subdividePrism(const bezierCoeff &coeff,
   subCoeff2.push_back(subCoeff[5]);
   subCoeff2.push_back(subCoeff[6]);
   subCoeff2.push_back(subCoeff[7]);
-  _copyLine(_sub, n * ntri, 0, *subCoeff[0]);
-  _copyLine(_sub, n * ntri, (n - 1) * ntri, *subCoeff2[0]);
+  _copyLine(sub, n * ntri, 0, *subCoeff[0]);
+  _copyLine(sub, n * ntri, (n - 1) * ntri, *subCoeff2[0]);
 
   // Second, subdivide in the triangular space:
   for(int k = 0; k < n; ++k) {
@@ -1350,39 +1349,39 @@ void bezierCoeff::_subdividePyramid(const bezierCoeff &coeff,
   const int Nk = 2 * nk - 1;
   const int dim = coeff._c;
 
-  _sub.resize(Nij * Nij * Nk, dim, false);
+  fullMatrix<double> sub(Nij * Nij * Nk, dim);
   for(int i = 0; i < nij; ++i) {
     for(int j = 0; j < nij; ++j) {
       for(int k = 0; k < nk; ++k) {
         const int I1 = i + j * nij + k * nij * nij;
         const int I2 = (2 * i) + (2 * j) * Nij + (2 * k) * Nij * Nij;
-        for(int k = 0; k < dim; ++k) { _sub(I2, k) = coeff(I1, k); }
+        for(int k = 0; k < dim; ++k) { sub(I2, k) = coeff(I1, k); }
       }
     }
   }
   for(int i = 0; i < Nij; i += 2) {
     for(int j = 0; j < Nij; j += 2) {
-      _subdivide(_sub, nk, i + j * Nij, Nij * Nij);
+      _subdivide(sub, nk, i + j * Nij, Nij * Nij);
     }
   }
   for(int i = 0; i < Nij; i += 2) {
     for(int k = 0; k < Nk; ++k) {
-      _subdivide(_sub, nij, i + k * Nij * Nij, Nij);
+      _subdivide(sub, nij, i + k * Nij * Nij, Nij);
     }
   }
   for(int j = 0; j < Nij; ++j) {
     for(int k = 0; k < Nk; ++k) {
-      _subdivide(_sub, nij, j * Nij + k * Nij * Nij);
+      _subdivide(sub, nij, j * Nij + k * Nij * Nij);
     }
   }
-  _copyPyr(_sub, nij, nk, 0, 0, 0, *subCoeff[0]);
-  _copyPyr(_sub, nij, nk, nij - 1, 0, 0, *subCoeff[1]);
-  _copyPyr(_sub, nij, nk, 0, nij - 1, 0, *subCoeff[2]);
-  _copyPyr(_sub, nij, nk, nij - 1, nij - 1, 0, *subCoeff[3]);
-  _copyPyr(_sub, nij, nk, 0, 0, nk - 1, *subCoeff[4]);
-  _copyPyr(_sub, nij, nk, nij - 1, 0, nk - 1, *subCoeff[5]);
-  _copyPyr(_sub, nij, nk, 0, nij - 1, nk - 1, *subCoeff[6]);
-  _copyPyr(_sub, nij, nk, nij - 1, nij - 1, nk - 1, *subCoeff[7]);
+  _copyPyr(sub, nij, nk, 0, 0, 0, *subCoeff[0]);
+  _copyPyr(sub, nij, nk, nij - 1, 0, 0, *subCoeff[1]);
+  _copyPyr(sub, nij, nk, 0, nij - 1, 0, *subCoeff[2]);
+  _copyPyr(sub, nij, nk, nij - 1, nij - 1, 0, *subCoeff[3]);
+  _copyPyr(sub, nij, nk, 0, 0, nk - 1, *subCoeff[4]);
+  _copyPyr(sub, nij, nk, nij - 1, 0, nk - 1, *subCoeff[5]);
+  _copyPyr(sub, nij, nk, 0, nij - 1, nk - 1, *subCoeff[6]);
+  _copyPyr(sub, nij, nk, nij - 1, nij - 1, nk - 1, *subCoeff[7]);
   return;
 }
 
@@ -135,8 +135,8 @@ private:
 
   static bezierCoeffMemoryPool *_pool0;
   static bezierCoeffMemoryPool *_pool1;
-  static fullMatrix<double> _sub;
-  // FIXME: not thread safe. We shoud use one pool and one _sub per thread.
+  // FIXME: not thread safe. We shoud use one pool per thread. In the meantime,
+  //        coefficients computed concurrently should not use the pools.
   //        The best would be to give the pool to the constructor.
   //        (the pools should be created and deleted e.g. by the plugin
   //        AnalyseMeshQuality)
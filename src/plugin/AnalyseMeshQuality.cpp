@@ -17,6 +17,7 @@
 #include "bezierBasis.h"
 #include <sstream>
 #include <fstream>
+#include <algorithm>
 #if defined(HAVE_OPENGL)
 #include "drawContext.h"
 #endif
@@ -302,17 +303,26 @@ void GMSH_AnalyseMeshQualityPlugin::_computeMinMaxJandValidity(int dim)
     MsgProgressStatus progress(num);
 
     _data.reserve(_data.size() + num);
-    for(unsigned i = 0; i < num; ++i) {
-      MElement *el = entity->getMeshElement(i);
-      double min, max;
-      jacobianBasedQuality::minMaxJacobianDeterminant(el, min, max, normals);
-      _data.push_back(data_elementMinMax(el, min, max));
-      if(min < 0 && max < 0) ++cntInverted;
-      progress.next();
+    // sample the Jacobian determinant of blocks of elements at once
+    const unsigned blockSize = 1000;
+    std::vector<MElement *> block;
+    std::vector<double> min, max;
+    for(unsigned first = 0; first < num; first += blockSize) {
+      const unsigned last = std::min(num, first + blockSize);
+      block.clear();
+      for(unsigned i = first; i < last; ++i)
+        block.push_back(entity->getMeshElement(i));
+      jacobianBasedQuality::minMaxJacobianDeterminant(block, min, max, normals);
+      for(std::size_t i = 0; i < block.size(); ++i) {
+        MElement *el = block[i];
+        _data.push_back(data_elementMinMax(el, min[i], max[i]));
+        if(min[i] < 0 && max[i] < 0) ++cntInverted;
+        progress.next();
 
 #if defined(HAVE_VISUDEV)
-      _computePointwiseQuantities(el, normals);
+        _computePointwiseQuantities(el, normals);
 #endif
+      }
     }
     if(normals) delete normals;
   }
@@ -330,14 +340,29 @@ void GMSH_AnalyseMeshQualityPlugin::_computeMinIGE(int dim)
 
   MsgProgressStatus progress(_data.size());
 
+  // compute the measure of blocks of valid elements at once (in parallel)
+  const std::size_t blockSize = 1000;
+  std::vector<std::size_t> index;
+  std::vector<MElement *> block;
+  std::vector<double> measure;
   for(std::size_t i = 0; i < _data.size(); ++i) {
     MElement *const el = _data[i].element();
-    if(el->getDim() != dim) continue;
-    if(_data[i].minJ() <= 0 && _data[i].maxJ() >= 0) { _data[i].setMinS(0); }
-    else {
-      _data[i].setMinS(jacobianBasedQuality::minIGEMeasure(el, true));
+    if(el->getDim() == dim) {
+      if(_data[i].minJ() <= 0 && _data[i].maxJ() >= 0)
+        _data[i].setMinS(0);
+      else {
+        index.push_back(i);
+        block.push_back(el);
+      }
+      progress.next();
+    }
+    if(block.size() == blockSize || (i + 1 == _data.size() && block.size())) {
+      jacobianBasedQuality::minIGEMeasure(block, measure, true);
+      for(std::size_t j = 0; j < block.size(); ++j)
+        _data[index[j]].setMinS(measure[j]);
+      index.clear();
+      block.clear();
     }
-    progress.next();
   }
 
   _computedIGE[dim - 1] = true;
@@ -349,14 +374,29 @@ void GMSH_AnalyseMeshQualityPlugin::_computeMinICN(int dim)
 
   MsgProgressStatus progress(_data.size());
 
+  // compute the measure of blocks of valid elements at once (in parallel)
+  const std::size_t blockSize = 1000;
+  std::vector<std::size_t> index;
+  std::vector<MElement *> block;
+  std::vector<double> measure;
   for(std::size_t i = 0; i < _data.size(); ++i) {
     MElement *const el = _data[i].element();
-    if(el->getDim() != dim) continue;
-    if(_data[i].minJ() <= 0 && _data[i].maxJ() >= 0) { _data[i].setMinI(0); }
-    else {
-      _data[i].setMinI(jacobianBasedQuality::minICNMeasure(el, true));
+    if(el->getDim() == dim) {
+      if(_data[i].minJ() <= 0 && _data[i].maxJ() >= 0)
+        _data[i].setMinI(0);
+      else {
+        index.push_back(i);
+        block.push_back(el);
+      }
+      progress.next();
+    }
+    if(block.size() == blockSize || (i + 1 == _data.size() && block.size())) {
+      jacobianBasedQuality::minICNMeasure(block, measure, true);
+      for(std::size_t j = 0; j < block.size(); ++j)
+        _data[index[j]].setMinI(measure[j]);
+      index.clear();
+      block.clear();
     }
-    progress.next();
   }
 
   _computedICN[dim - 1] = true;
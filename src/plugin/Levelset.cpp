@@ -3,6 +3,7 @@
 // See the LICENSE.txt file in the Gmsh root directory for license information.
 // Please report all issues on https://gitlab.onelab.info/gmsh/gmsh/issues.
 
+#include <algorithm>
 #include "Levelset.h"
 #include "MakeSimplex.h"
 #include "Numeric.h"
@@ -10,6 +11,7 @@
 #include "adaptiveData.h"
 #include "GmshDefines.h"
 #include "PViewOptions.h"
+#include "Context.h"
 
 static const int exn[13][12][2] = {
   {{0, 0}}, // point
@@ -223,7 +225,6 @@ static void reorderPrism(int numComp, double xp[12], double yp[12],
 
 GMSH_LevelsetPlugin::GMSH_LevelsetPlugin()
 {
-  _invert = 0.;
   _ref[0] = _ref[1] = _ref[2] = 0.;
   _valueIndependent = 0; // "moving" levelset
   _valueView = -1; // use same view for levelset and field data
@@ -238,7 +239,8 @@ GMSH_LevelsetPlugin::GMSH_LevelsetPlugin()
 void GMSH_LevelsetPlugin::_addElement(int np, int numEdges, int numComp,
                                       double xp[12], double yp[12],
                                       double zp[12], double valp[12][9],
-                                      PViewDataList *out, bool firstStep)
+                                      PViewDataList *out,
+                                      bool firstStep) const
 {
   std::vector<double> *list;
   int *nbPtr;
@@ -371,35 +373,30 @@ void GMSH_LevelsetPlugin::_addElement(int np, int numEdges, int numComp,
     for(int l = 0; l < numComp; l++) list->push_back(valp[k][l]);
 }
 
-void GMSH_LevelsetPlugin::_cutAndAddElements(
-  PViewData *vdata, PViewData *wdata, int ent, int ele, int vstep, int wstep,
-  double x[8], double y[8], double z[8], double levels[8],
-  double scalarValues[8], PViewDataList *out)
+void GMSH_LevelsetPlugin::_cutAndAddElements(cutElement &e,
+                                             const double *values,
+                                             int stepmin, int stepmax,
+                                             int wstep,
+                                             const std::vector<char> &hasStep,
+                                             PViewDataList *out) const
 {
-  int stepmin = vstep, stepmax = vstep + 1, otherstep = wstep;
-  if(stepmin < 0) {
-    stepmin = vdata->getFirstNonEmptyTimeStep();
-    stepmax = vdata->getNumTimeSteps();
-  }
-  if(wstep < 0) otherstep = wdata->getFirstNonEmptyTimeStep();
-
-  int numNodes = vdata->getNumNodes(stepmin, ent, ele);
-  int numEdges = vdata->getNumEdges(stepmin, ent, ele);
-  int numComp = wdata->getNumComponents(otherstep, ent, ele);
-  int type = vdata->getType(stepmin, ent, ele);
+  double *x = e.x, *y = e.y, *z = e.z, *levels = e.levels;
+  int numEdges = e.numEdges, numComp = e.numComp;
+  int numValues = e.numNodes * numComp;
+  double invert = 0.;
 
   // decompose the element into simplices
-  for(int simplex = 0; simplex < numSimplexDec(type); simplex++) {
+  for(int simplex = 0; simplex < numSimplexDec(e.type); simplex++) {
     int n[4], ep[12], nsn, nse;
-    getSimplexDec(numNodes, numEdges, type, simplex, n[0], n[1], n[2], n[3],
-                  nsn, nse);
+    getSimplexDec(e.numNodes, numEdges, e.type, simplex, n[0], n[1], n[2],
+                  n[3], nsn, nse);
 
     // loop over time steps
     for(int step = stepmin; step < stepmax; step++) {
       // check which edges cut the iso and interpolate the value
-      if(wstep < 0) otherstep = step;
-
-      if(!wdata->hasTimeStep(otherstep)) continue;
+      int vs = (wstep < 0) ? step - stepmin : 0;
+      if(!hasStep[vs]) continue;
+      const double *val = &values[vs * numValues];
 
       int np = 0;
       double xp[12], yp[12], zp[12], valp[12][9];
@@ -409,9 +406,8 @@ void GMSH_LevelsetPlugin::_cutAndAddElements(
           double c = InterpolateIso(x, y, z, levels, 0., n[n0], n[n1], &xp[np],
                                     &yp[np], &zp[np]);
           for(int comp = 0; comp < numComp; comp++) {
-            double v0, v1;
-            wdata->getValue(otherstep, ent, ele, n[n0], comp, v0);
-            wdata->getValue(otherstep, ent, ele, n[n1], comp, v1);
+            double v0 = val[n[n0] * numComp + comp];
+            double v1 = val[n[n1] * numComp + comp];
             valp[np][comp] = v0 + c * (v1 - v0);
           }
           ep[np++] = i + 1;
@@ -439,8 +435,7 @@ void GMSH_LevelsetPlugin::_cutAndAddElements(
             yp[nod] = y[n[nod]];
             zp[nod] = z[n[nod]];
             for(int comp = 0; comp < numComp; comp++)
-              wdata->getValue(otherstep, ent, ele, n[nod], comp,
-                              valp[nod][comp]);
+              valp[nod][comp] = val[n[nod] * numComp + comp];
           }
           _addElement(nsn, nse, numComp, xp, yp, zp, valp, out,
                       step == stepmin);
@@ -469,20 +464,20 @@ void GMSH_LevelsetPlugin::_cutAndAddElements(
           prodve(v1, v2, normal);
           switch(_orientation) {
           case MAP:
-            gradSimplex(x, y, z, scalarValues, gr);
-            _invert = prosca(gr, normal);
+            gradSimplex(x, y, z, e.scalarValues, gr);
+            invert = prosca(gr, normal);
             break;
-          case PLANE: _invert = prosca(normal, _ref); break;
+          case PLANE: invert = prosca(normal, _ref); break;
           case SPHERE:
             gr[0] = xp[0] - _ref[0];
             gr[1] = yp[0] - _ref[1];
             gr[2] = zp[0] - _ref[2];
-            _invert = prosca(gr, normal);
+            invert = prosca(gr, normal);
           case NONE:
           default: break;
           }
         }
-        if(_invert > 0.) {
+        if(invert > 0.) {
           double xpi[12], ypi[12], zpi[12], valpi[12][9];
           int epi[12];
           for(int k = 0; k < np; k++)
@@ -504,8 +499,7 @@ void GMSH_LevelsetPlugin::_cutAndAddElements(
             yp[np] = y[n[nod]];
             zp[np] = z[n[nod]];
             for(int comp = 0; comp < numComp; comp++)
-              wdata->getValue(otherstep, ent, ele, n[nod], comp,
-                              valp[np][comp]);
+              valp[np][comp] = val[n[nod] * numComp + comp];
             ep[np] = -(nod + 1); // store node num!
             np++;
           }
@@ -534,15 +528,121 @@ void GMSH_LevelsetPlugin::_cutAndAddElements(
       _addElement(np, numEdges, numComp, xp, yp, zp, valp, out,
                   step == stepmin);
     }
+  }
+}
 
+void GMSH_LevelsetPlugin::_initBlock(PViewData *vdata, PViewData *wdata,
+                                     int vstep, int wstep, cutBlock &block)
+{
+  block.stepmin = vstep;
+  block.stepmax = vstep + 1;
+  if(vstep < 0) {
+    block.stepmin = vdata->getFirstNonEmptyTimeStep();
+    block.stepmax = vdata->getNumTimeSteps();
   }
+  block.wstep = wstep;
+  // if no specific step is requested for the values, each step uses its own
+  // values
+  int numValueSteps = (wstep < 0) ? block.stepmax - block.stepmin : 1;
+  block.hasStep.resize(std::max(numValueSteps, 0));
+  for(int vs = 0; vs < numValueSteps; vs++)
+    block.hasStep[vs] =
+      wdata->hasTimeStep((wstep < 0) ? block.stepmin + vs : wstep);
+  block.elements.clear();
+  block.values.clear();
+}
 
-  if(vstep < 0 && (stepmax - stepmin) > (int)out->Time.size()) {
-    out->Time.clear();
-    for(int i = stepmin; i < stepmax; i++) {
-      out->Time.push_back(vdata->getTime(i));
+void GMSH_LevelsetPlugin::_addToBlock(PViewData *vdata, PViewData *wdata,
+                                      int ent, int ele, double x[8],
+                                      double y[8], double z[8],
+                                      double levels[8], double scalarValues[8],
+                                      cutBlock &block, PViewDataList *out)
+{
+  int stepmin = block.stepmin, wstep = block.wstep, otherstep = wstep;
+  if(wstep < 0) otherstep = wdata->getFirstNonEmptyTimeStep();
+
+  cutElement e;
+  e.numNodes = vdata->getNumNodes(stepmin, ent, ele);
+  e.numEdges = vdata->getNumEdges(stepmin, ent, ele);
+  e.numComp = wdata->getNumComponents(otherstep, ent, ele);
+  e.type = vdata->getType(stepmin, ent, ele);
+
+  // fast path: if we don't extract volumes, elements whose levelset range
+  // does not contain zero cannot produce any output. (The range is checked
+  // per element and not per entity: a per-entity range would require the
+  // levelset at all the nodes of the entity, which is what is computed here,
+  // and PViewData provides no way to know when a range cached between two
+  // executions of the plugin becomes invalid.)
+  if(!_extractVolume) {
+    double lmin = levels[0], lmax = levels[0];
+    for(int nod = 1; nod < e.numNodes; nod++) {
+      lmin = std::min(lmin, levels[nod]);
+      lmax = std::max(lmax, levels[nod]);
     }
+    if(lmin > 0. || lmax < 0.) return;
   }
+
+  for(int nod = 0; nod < e.numNodes; nod++) {
+    e.x[nod] = x[nod];
+    e.y[nod] = y[nod];
+    e.z[nod] = z[nod];
+    e.levels[nod] = levels[nod];
+    e.scalarValues[nod] = scalarValues[nod];
+  }
+
+  // store the values of the element for all the required steps
+  e.values = block.values.size();
+  for(std::size_t vs = 0; vs < block.hasStep.size(); vs++) {
+    int s = (wstep < 0) ? stepmin + vs : wstep;
+    for(int nod = 0; nod < e.numNodes; nod++) {
+      for(int comp = 0; comp < e.numComp; comp++) {
+        double v = 0.;
+        if(block.hasStep[vs]) wdata->getValue(s, ent, ele, nod, comp, v);
+        block.values.push_back(v);
+      }
+    }
+  }
+  block.elements.push_back(e);
+
+  if(block.elements.size() >= 65536 || block.values.size() >= 4194304)
+    _cutBlock(block, out);
+}
+
+void GMSH_LevelsetPlugin::_cutBlock(cutBlock &block, PViewDataList *out)
+{
+  std::size_t nthreads = block.out.size();
+  std::size_t numElements = block.elements.size();
+  if(!numElements) return;
+
+  if(nthreads == 1 || numElements < 1000) {
+    for(std::size_t i = 0; i < numElements; i++)
+      _cutAndAddElements(block.elements[i],
+                         block.values.data() + block.elements[i].values,
+                         block.stepmin, block.stepmax, block.wstep,
+                         block.hasStep, out);
+  }
+  else {
+    // each thread cuts a contiguous range of elements into its own buffer;
+    // appending the buffers in thread order thus preserves the element order
+#pragma omp parallel num_threads(nthreads)
+    {
+      std::size_t t = Msg::GetThreadNum();
+      std::size_t nt = Msg::GetNumThreads();
+      std::size_t start = (numElements * t) / nt;
+      std::size_t end = (numElements * (t + 1)) / nt;
+      for(std::size_t i = start; i < end; i++)
+        _cutAndAddElements(block.elements[i],
+                           block.values.data() + block.elements[i].values,
+                           block.stepmin, block.stepmax, block.wstep,
+                           block.hasStep, block.out[t]);
+    }
+    for(std::size_t t = 0; t < nthreads; t++)
+      out->appendElements(*block.out[t], true);
+  }
+
+  // keep the capacity of the buffers for the next block
+  block.elements.clear();
+  block.values.clear();
 }
 
 PView *GMSH_LevelsetPlugin::execute(PView *v)
@@ -583,12 +683,19 @@ PView *GMSH_LevelsetPlugin::execute(PView *v)
   double x[8], y[8], z[8], levels[8];
   double scalarValues[8] = {0., 0., 0., 0., 0., 0., 0., 0.};
 
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+  cutBlock block;
+  for(int i = 0; i < nthreads; i++) block.out.push_back(new PViewDataList());
+
   PView *v2 = nullptr;
   if(_valueIndependent) {
     // create a single output view containing the (possibly multi-step) levelset
     int firstNonEmptyStep = vdata->getFirstNonEmptyTimeStep();
     v2 = new PView();
     PViewDataList *out = getDataList(v2);
+    _initBlock(vdata, wdata, -1, _valueTimeStep, block);
+    bool empty = true;
     for(int ent = 0; ent < vdata->getNumEntities(firstNonEmptyStep); ent++) {
       for(int ele = 0; ele < vdata->getNumElements(firstNonEmptyStep, ent);
           ele++) {
@@ -599,10 +706,17 @@ PView *GMSH_LevelsetPlugin::execute(PView *v)
                          z[nod]);
           levels[nod] = levelset(x[nod], y[nod], z[nod], 0.);
         }
-        _cutAndAddElements(vdata, wdata, ent, ele, -1, _valueTimeStep, x, y, z,
-                           levels, scalarValues, out);
+        _addToBlock(vdata, wdata, ent, ele, x, y, z, levels, scalarValues,
+                    block, out);
+        empty = false;
       }
     }
+    _cutBlock(block, out);
+    if(!empty && (block.stepmax - block.stepmin) > (int)out->Time.size()) {
+      out->Time.clear();
+      for(int i = block.stepmin; i < block.stepmax; i++)
+        out->Time.push_back(vdata->getTime(i));
+    }
     out->setName(vdata->getName() + "_Levelset");
     out->setFileName(vdata->getFileName() + "_Levelset.pos");
     out->finalize();
@@ -613,6 +727,8 @@ PView *GMSH_LevelsetPlugin::execute(PView *v)
       if(!vdata->hasTimeStep(step)) continue;
       v2 = new PView();
       PViewDataList *out = getDataList(v2);
+      int wstep = (_valueTimeStep < 0) ? step : _valueTimeStep;
+      _initBlock(vdata, wdata, step, wstep, block);
       for(int ent = 0; ent < vdata->getNumEntities(step); ent++) {
         for(int ele = 0; ele < vdata->getNumElements(step, ent); ele++) {
           if(vdata->skipElement(step, ent, ele)) continue;
@@ -621,11 +737,11 @@ PView *GMSH_LevelsetPlugin::execute(PView *v)
             vdata->getScalarValue(step, ent, ele, nod, scalarValues[nod]);
             levels[nod] = levelset(x[nod], y[nod], z[nod], scalarValues[nod]);
           }
-          int wstep = (_valueTimeStep < 0) ? step : _valueTimeStep;
-          _cutAndAddElements(vdata, wdata, ent, ele, step, wstep, x, y, z,
-                             levels, scalarValues, out);
+          _addToBlock(vdata, wdata, ent, ele, x, y, z, levels, scalarValues,
+                      block, out);
         }
       }
+      _cutBlock(block, out);
       char tmp[246];
       sprintf(tmp, "_Levelset_%d", step);
       out->setName(vdata->getName() + tmp);
@@ -634,6 +750,8 @@ PView *GMSH_LevelsetPlugin::execute(PView *v)
     }
   }
 
+  for(std::size_t i = 0; i < block.out.size(); i++) delete block.out[i];
+
   return v2;
 }
 
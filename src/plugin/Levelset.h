@@ -6,18 +6,39 @@
 #ifndef LEVELSET_H
 #define LEVELSET_H
 
+#include <vector>
 #include "Plugin.h"
 
 class GMSH_LevelsetPlugin : public GMSH_PostPlugin {
 private:
-  double _invert;
+  // element data gathered (serially) from the view data, so that the cuts can
+  // then be computed in parallel
+  struct cutElement {
+    int numNodes, numEdges, numComp, type;
+    double x[8], y[8], z[8], levels[8], scalarValues[8];
+    std::size_t values; // offset of the values (for all steps) in the block
+  };
+  struct cutBlock {
+    int stepmin, stepmax, wstep;
+    std::vector<cutElement> elements;
+    std::vector<double> values;
+    std::vector<char> hasStep; // value steps with data
+    std::vector<PViewDataList *> out; // one output buffer per thread
+  };
   void _addElement(int np, int numEdges, int numComp, double xp[12],
                    double yp[12], double zp[12], double valp[12][9],
-                   PViewDataList *out, bool firstStep);
-  void _cutAndAddElements(PViewData *vdata, PViewData *wdata, int ent, int ele,
-                          int step, int wstep, double x[8], double y[8],
-                          double z[8], double levels[8], double scalarValues[8],
-                          PViewDataList *out);
+                   PViewDataList *out, bool firstStep) const;
+  void _cutAndAddElements(cutElement &e, const double *values,
+                          int stepmin, int stepmax, int wstep,
+                          const std::vector<char> &hasStep,
+                          PViewDataList *out) const;
+  void _initBlock(PViewData *vdata, PViewData *wdata, int vstep, int wstep,
+                  cutBlock &block);
+  void _addToBlock(PViewData *vdata, PViewData *wdata, int ent, int ele,
+                   double x[8], double y[8], double z[8], double levels[8],
+                   double scalarValues[8], cutBlock &block,
+                   PViewDataList *out);
+  void _cutBlock(cutBlock &block, PViewDataList *out);
 
 protected:
   double _ref[3], _targetError;
@@ -3,6 +3,7 @@
 // See the LICENSE.txt file in the Gmsh root directory for license information.
 // Please report all issues on https://gitlab.onelab.info/gmsh/gmsh/issues.
 
+#include <algorithm>
 #include "GmshConfig.h"
 #include "NearestNeighbor.h"
 
@@ -53,9 +54,42 @@ PView *GMSH_NearestNeighborPlugin::execute(PView *v)
     return nullptr;
   }
 
+  int step = 0;
+  if(data1->getNumElements() == totpoints) {
+    // the view only contains points: use a batched query in the kdtree of the
+    // view, the closest node being the point itself
+    std::vector<double> xyz;
+    for(int ent = 0; ent < data1->getNumEntities(step); ent++) {
+      for(int ele = 0; ele < data1->getNumElements(step, ent); ele++) {
+        if(data1->skipElement(step, ent, ele)) continue;
+        double x, y, z;
+        data1->getNode(step, ent, ele, 0, x, y, z);
+        xyz.push_back(x);
+        xyz.push_back(y);
+        xyz.push_back(z);
+      }
+    }
+    std::vector<double> nodes, dist;
+    data1->buildKDTree(step);
+    data1->findClosestNodes(xyz, 2, nodes, dist, step);
+
+    v1->setChanged(true);
+    std::size_t k = 0;
+    for(int ent = 0; ent < data1->getNumEntities(step); ent++) {
+      for(int ele = 0; ele < data1->getNumElements(step, ent); ele++) {
+        if(data1->skipElement(step, ent, ele)) continue;
+        data1->setValue(step, ent, ele, 0, 0, std::max(dist[2 * k + 1], 0.));
+        k++;
+      }
+    }
+    data1->setName(v1->getData()->getName() + "_NearestNeighbor");
+    data1->finalize();
+    return v1;
+  }
+
 #if defined(HAVE_ANN)
   ANNpointArray zeronodes = annAllocPts(totpoints, 3);
-  int k = 0, step = 0;
+  int k = 0;
   for(int ent = 0; ent < data1->getNumEntities(step); ent++) {
     for(int ele = 0; ele < data1->getNumElements(step, ent); ele++) {
       if(data1->skipElement(step, ent, ele)) continue;
@@ -33,6 +33,7 @@ void PView::_init(int tag)
   _aliasOf = -1;
   _eye = SPoint3(0., 0., 0.);
   va_points = va_lines = va_triangles = va_vectors = va_ellipses = nullptr;
+  va_lines_lod = va_triangles_lod = nullptr;
   normals = nullptr;
 
   for(std::size_t i = 0; i < list.size(); i++) {
@@ -219,6 +220,10 @@ void PView::deleteVertexArrays()
   va_vectors = nullptr;
   if(va_ellipses) delete va_ellipses;
   va_ellipses = nullptr;
+  if(va_lines_lod) delete va_lines_lod;
+  va_lines_lod = nullptr;
+  if(va_triangles_lod) delete va_triangles_lod;
+  va_triangles_lod = nullptr;
 }
 
 void PView::setOptions(PViewOptions *val)
@@ -393,6 +398,8 @@ double PView::getMemoryInMb()
   if(va_triangles) mem += va_triangles->getMemoryInMb();
   if(va_vectors) mem += va_vectors->getMemoryInMb();
   if(va_ellipses) mem += va_ellipses->getMemoryInMb();
+  if(va_lines_lod) mem += va_lines_lod->getMemoryInMb();
+  if(va_triangles_lod) mem += va_triangles_lod->getMemoryInMb();
   mem += getData()->getMemoryInMb();
   return mem;
 }
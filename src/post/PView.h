@@ -155,6 +155,10 @@ public:
   // vertex arrays to draw the elements efficiently
   VertexArray *va_points, *va_lines, *va_triangles, *va_vectors, *va_ellipses;
 
+  // decimated versions of the line and triangle vertex arrays (level of
+  // detail), if any
+  VertexArray *va_lines_lod, *va_triangles_lod;
+
   // fill the vertex arrays, given the current option and data
   bool fillVertexArrays();
 
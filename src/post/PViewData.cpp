@@ -9,6 +9,7 @@
 #include "GmshMessage.h"
 #include "OctreePost.h"
 #include "fullMatrix.h"
+#include "Context.h"
 
 std::map<std::string, interpolationMatrices> PViewData::_interpolationSchemes;
 
@@ -24,7 +25,7 @@ PViewData::~PViewData()
   for(auto it = _interpolation.begin(); it != _interpolation.end(); it++)
     for(std::size_t i = 0; i < it->second.size(); i++) delete it->second[i];
   if(_octree) delete _octree;
-  if(_kdtree) delete _kdtree;
+  _deleteKDTree();
 }
 
 bool PViewData::finalize(bool computeMinMax,
@@ -245,78 +246,103 @@ bool PViewData::combineSpace(nameData &nd)
   return false;
 }
 
-double PViewData::findClosestNode(double &xn, double &yn, double &zn, int step)
+void PViewData::_getKDTreeNodes(int step, std::vector<SPoint3> &pts)
 {
-  double x = xn, y = yn, z = zn;
-
-#if 0
-
-  // slow, naive implementation; beware that iterations on view data is
-  // currently not thread-safe (it uses a cache for the current element/node)
-  double dist2 = 1e200;
-#pragma omp critical
-  {
-    if(step < 0) step = getFirstNonEmptyTimeStep();
-    for(int ent = 0; ent < getNumEntities(step); ent++) {
-      for(int ele = 0; ele < getNumElements(step, ent); ele++) {
-        int numNodes = getNumNodes(step, ent, ele);
-        for(int nod = 0; nod < numNodes; nod++) {
-          double xx, yy, zz;
-          getNode(step, ent, ele, nod, xx, yy, zz);
-          double d2 =
-            (x - xx) * (x - xx) + (y - yy) * (y - yy) + (z - zz) * (z - zz);
-          if(d2 < dist2) {
-            dist2 = d2;
-            xn = xx;
-            yn = yy;
-            zn = zz;
-          }
-        }
+  // iterations on view data are not thread-safe (they use a cache for the
+  // current element/node)
+  if(step < 0) step = getFirstNonEmptyTimeStep();
+  for(int ent = 0; ent < getNumEntities(step); ent++) {
+    for(int ele = 0; ele < getNumElements(step, ent); ele++) {
+      if(skipElement(step, ent, ele)) continue;
+      int numNodes = getNumNodes(step, ent, ele);
+      for(int nod = 0; nod < numNodes; nod++) {
+        double xx, yy, zz;
+        getNode(step, ent, ele, nod, xx, yy, zz);
+        pts.push_back(SPoint3(xx, yy, zz));
       }
     }
   }
-  return sqrt(dist2);
+}
 
-#else
+void PViewData::_deleteKDTree()
+{
+  SPoint3KDTree *kdtree = _kdtree.exchange(nullptr);
+  if(kdtree) delete kdtree;
+  _pc.pts.clear();
+}
 
-#pragma omp critical
-  if(!_kdtree) {
-    Msg::Debug("Rebuilding kdtree for view data '%s'", _name.c_str());
+void PViewData::buildKDTree(int step)
+{
+#pragma omp critical(PViewDataKDTree)
+  if(!_kdtree.load(std::memory_order_acquire)) {
+    Msg::Debug("Building kdtree for view data '%s'", _name.c_str());
     _pc.pts.clear();
-    // FIXME: should directly iterate on mesh nodes for model-based views
-    if(step < 0) step = getFirstNonEmptyTimeStep();
-    for(int ent = 0; ent < getNumEntities(step); ent++) {
-      for(int ele = 0; ele < getNumElements(step, ent); ele++) {
-        int numNodes = getNumNodes(step, ent, ele);
-        for(int nod = 0; nod < numNodes; nod++) {
-          double xx, yy, zz;
-          getNode(step, ent, ele, nod, xx, yy, zz);
-          _pc.pts.push_back(SPoint3(xx, yy, zz));
-        }
-      }
-    }
-    _kdtree = new SPoint3KDTree(3, _pc2kdtree,
-                                nanoflann::KDTreeSingleIndexAdaptorParams(10));
-    _kdtree->buildIndex();
+    _getKDTreeNodes(step, _pc.pts);
+    SPoint3KDTree *kdtree = new SPoint3KDTree(
+      3, _pc2kdtree, nanoflann::KDTreeSingleIndexAdaptorParams(10));
+    kdtree->buildIndex();
+    _kdtree.store(kdtree, std::memory_order_release);
   }
+}
 
-  double query_pt[3] = {x, y, z};
-  std::size_t idx;
+double PViewData::findClosestNode(double &xn, double &yn, double &zn, int step)
+{
+  SPoint3KDTree *kdtree = _kdtree.load(std::memory_order_acquire);
+  if(!kdtree) {
+    buildKDTree(step);
+    kdtree = _kdtree.load(std::memory_order_acquire);
+  }
+  if(_pc.pts.empty()) return -1.;
+
+  double query_pt[3] = {xn, yn, zn};
+  std::size_t idx = 0;
   double squ_dist = 0.;
   nanoflann::KNNResultSet<double> resultSet(1);
   resultSet.init(&idx, &squ_dist);
-  _kdtree->findNeighbors(resultSet, &query_pt[0], nanoflann::SearchParams(10));
-  if(idx < _pc.pts.size()) {
+  kdtree->findNeighbors(resultSet, &query_pt[0], nanoflann::SearchParams(10));
+  if(resultSet.size() && idx < _pc.pts.size()) {
     xn = _pc.pts[idx].x();
     yn = _pc.pts[idx].y();
     zn = _pc.pts[idx].z();
     return sqrt(squ_dist);
   }
-  else{
-    return -1.;
-  }
+  return -1.;
+}
+
+void PViewData::findClosestNodes(const std::vector<double> &xyz, std::size_t k,
+                                 std::vector<double> &nodes,
+                                 std::vector<double> &distances, int step)
+{
+  std::size_t n = xyz.size() / 3;
+  nodes.assign(n * k * 3, 0.);
+  distances.assign(n * k, -1.);
+  if(!n || !k) return;
 
-#endif
+  buildKDTree(step);
+  const SPoint3KDTree *kdtree = _kdtree.load(std::memory_order_acquire);
+  if(_pc.pts.empty()) return;
+
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+
+#pragma omp parallel num_threads(nthreads)
+  {
+    std::vector<std::size_t> idx(k);
+    std::vector<double> squ_dist(k);
+#pragma omp for schedule(dynamic, 256)
+    for(int i = 0; i < (int)n; i++) {
+      nanoflann::KNNResultSet<double> resultSet(k);
+      resultSet.init(&idx[0], &squ_dist[0]);
+      kdtree->findNeighbors(resultSet, &xyz[3 * i], nanoflann::SearchParams(10));
+      for(std::size_t j = 0; j < resultSet.size(); j++) {
+        const SPoint3 &p = _pc.pts[idx[j]];
+        nodes[3 * (i * k + j) + 0] = p.x();
+        nodes[3 * (i * k + j) + 1] = p.y();
+        nodes[3 * (i * k + j) + 2] = p.z();
+        distances[i * k + j] = sqrt(squ_dist[j]);
+      }
+    }
+  }
 }
 
 bool PViewData::searchScalar(double x, double y, double z, double *values,
@@ -10,6 +10,7 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <atomic>
 #include "SBoundingBox3d.h"
 #include "SPoint3KDTree.h"
 
@@ -39,12 +40,17 @@ private:
   int _fileIndex;
   // octree for rapid search
   OctreePost *_octree;
-  // kdtree for rapid search of neighrest neighbor
+  // kdtree for rapid search of nearest neighbor; once built, it is accessed
+  // without locking
   SPoint3Cloud _pc;
   SPoint3CloudAdaptor<SPoint3Cloud> _pc2kdtree;
-  SPoint3KDTree *_kdtree;
+  std::atomic<SPoint3KDTree *> _kdtree;
 
 protected:
+  // get the nodes used to build the kdtree
+  virtual void _getKDTreeNodes(int step, std::vector<SPoint3> &pts);
+  // delete the kdtree, e.g. because the nodes have changed
+  void _deleteKDTree();
   // adaptive visualization data
   adaptiveData *_adaptive;
   // interpolation matrices, indexed by the type of element
@@ -296,10 +302,23 @@ public:
   // get MElement (if view supports it)
   virtual MElement *getElement(int step, int entity, int element);
 
-  // find coordinates of closest node to point (xn, yn, zn); currently performs
-  // a simple linear search - we might want to use a kdtree instead
+  // build the kdtree of the nodes of the (non-skipped) elements of the given
+  // step, used by findClosestNode(s); the tree is built on first use if
+  // necessary, but should be built beforehand when queried from several threads
+  void buildKDTree(int step = -1);
+
+  // find coordinates of closest node to point (xn, yn, zn), and return the
+  // distance to it (or -1 if the view has no nodes)
   double findClosestNode(double &xn, double &yn, double &zn, int step);
 
+  // find the k closest nodes to each of the n points in xyz (stored as x1, y1,
+  // z1, x2, ...), in parallel: the coordinates of the nodes are returned in
+  // nodes (n * k * 3) and the distances in distances (n * k), sorted by
+  // increasing distance; missing nodes have a negative distance
+  void findClosestNodes(const std::vector<double> &xyz, std::size_t k,
+                        std::vector<double> &nodes,
+                        std::vector<double> &distances, int step = -1);
+
   // search for the value of the View at point x, y, z. Values are interpolated
   // using standard first order shape functions in the post element. If several
   // time steps are present, they are all interpolated unless time step is set
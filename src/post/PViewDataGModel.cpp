@@ -17,6 +17,7 @@
 #include "Numeric.h"
 #include "GmshMessage.h"
 #include "pyramidalBasis.h"
+#include "Context.h"
 
 PViewDataGModel::PViewDataGModel(DataType type)
   : PViewData(), _min(VAL_INF), _max(-VAL_INF), _type(type)
@@ -543,6 +544,53 @@ MVertex *PViewDataGModel::_getNode(MElement *e, int nod)
   return v;
 }
 
+void PViewDataGModel::_getKDTreeNodes(int step, std::vector<SPoint3> &pts)
+{
+  if(_type == GaussPointData) {
+    PViewData::_getKDTreeNodes(step, pts);
+    return;
+  }
+  if(_steps.empty()) return;
+  if(step < 0) step = getFirstNonEmptyTimeStep();
+
+  // iterate directly on the mesh elements (and not through the element cache
+  // used by getNode()), so that the nodes can be gathered in parallel; the
+  // elements skipped by the view (e.g. without data) are ignored
+  std::vector<MElement *> elements;
+  for(int ent = 0; ent < _steps[step]->getNumEntities(); ent++) {
+    GEntity *ge = _steps[step]->getEntity(ent);
+    for(std::size_t ele = 0; ele < ge->getNumMeshElements(); ele++) {
+      if(skipElement(step, ent, (int)ele)) continue;
+      elements.push_back(ge->getMeshElement(ele));
+    }
+  }
+  bool adaptive = getAdaptiveData() ? true : false;
+  std::vector<std::size_t> offset(elements.size() + 1, 0);
+  for(std::size_t i = 0; i < elements.size(); i++) {
+    MElement *e = elements[i];
+    std::size_t n;
+    if(e->getNumChildren())
+      n = e->getNumChildren() * e->getChild(0)->getNumVertices();
+    else if(adaptive)
+      n = e->getNumVertices();
+    else
+      n = e->getNumPrimaryVertices();
+    offset[i + 1] = offset[i] + n;
+  }
+  std::size_t first = pts.size();
+  pts.resize(first + offset.back());
+
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+#pragma omp parallel for schedule(dynamic, 1024) num_threads(nthreads)
+  for(int i = 0; i < (int)elements.size(); i++) {
+    for(std::size_t j = offset[i]; j < offset[i + 1]; j++) {
+      MVertex *v = _getNode(elements[i], (int)(j - offset[i]));
+      pts[first + j] = SPoint3(v->x(), v->y(), v->z());
+    }
+  }
+}
+
 int PViewDataGModel::getNode(int step, int ent, int ele, int nod, double &x,
                              double &y, double &z)
 {
@@ -204,6 +204,8 @@ private:
   // cache last element to speed up loops
   MElement *_getElement(int step, int ent, int ele);
   MVertex *_getNode(MElement *e, int nod);
+  // get the nodes used to build the kdtree directly from the mesh
+  void _getKDTreeNodes(int step, std::vector<SPoint3> &pts);
 
 public:
   PViewDataGModel(DataType type = NodeData);
@@ -146,6 +146,9 @@ bool PViewDataList::finalize(bool computeMinMax,
 
   if(CTX::instance()->post.smooth) smooth();
 
+  // the nodes are stored with the values, and might have changed
+  _deleteKDTree();
+
   return PViewData::finalize();
 }
 
@@ -1240,6 +1243,24 @@ void PViewDataList::setOrder2(int type)
                            fs->coefficients, fs->monomials);
 }
 
+void PViewDataList::appendElements(PViewDataList &other, bool clearOther)
+{
+  int *nbe = nullptr, *nbe2 = nullptr, nbn, nbn2, nbc, nbc2;
+  std::vector<double> *list = nullptr, *list2 = nullptr;
+  for(int i = 0; i < 27; i++) {
+    _getRawData(i, &list, &nbe, &nbc, &nbn);
+    other._getRawData(i, &list2, &nbe2, &nbc2, &nbn2);
+    if(*nbe2) {
+      list->insert(list->end(), list2->begin(), list2->end());
+      *nbe += *nbe2;
+    }
+    if(clearOther) {
+      list2->clear();
+      *nbe2 = 0;
+    }
+  }
+}
+
 std::vector<double> *PViewDataList::incrementList(int numComp, int type,
                                                   int numNodes)
 {
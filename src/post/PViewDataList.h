@@ -135,6 +135,10 @@ public:
   // specific to list-based data sets
   void setOrder2(int type);
   std::vector<double> *incrementList(int numComp, int type, int numNodes = 0);
+  // append the (non-polygonal) elements of another list-based dataset with the
+  // same time steps; the other dataset can be emptied on the way, keeping the
+  // capacity of its lists
+  void appendElements(PViewDataList &other, bool clearOther = false);
 
   // I/O routines
   bool readPOS(FILE *fp, double version, bool binary);
@@ -1325,7 +1325,8 @@ static void addTensorElement(PView *p, int iEnt, int iEle, int numNodes,
   }
 }
 
-static void addElementsInArrays(PView *p, bool preprocessNormalsOnly)
+static void addElementsInArrays(PView *p, bool preprocessNormalsOnly,
+                                std::vector<char> *volumeFaces = nullptr)
 {
   static int numNodesError = 0, numCompError = 0;
 
@@ -1418,6 +1419,8 @@ static void addElementsInArrays(PView *p, bool preprocessNormalsOnly)
       for(int j = 0; j < numNodes; j++)
         opt->tmpBBox += SPoint3(xyz[j][0], xyz[j][1], xyz[j][2]);
 
+      int numTriangles = p->va_triangles->getNumVertices() / 3;
+
       if(opt->showElement && !data->useGaussPoints())
         addOutlineElement(p, type, xyz, preprocessNormalsOnly, numNodes);
 
@@ -1454,6 +1457,13 @@ static void addElementsInArrays(PView *p, bool preprocessNormalsOnly)
           addTensorElement(p, ent, i, numNodes, type, xyz, val,
                            preprocessNormalsOnly);
       }
+
+      // mark the triangles coming from volume elements, so that only those are
+      // reduced to their boundary when decimating the triangle vertex array
+      if(volumeFaces && dim == 3) {
+        volumeFaces->resize(numTriangles, 0);
+        volumeFaces->resize(p->va_triangles->getNumVertices() / 3, 1);
+      }
     }
   }
   for(int j = 0; j < NMAX; j++) {
@@ -1587,8 +1597,9 @@ public:
 
     p->normals = new smooth_normals(opt->angleSmoothNormals);
 
+    std::vector<char> volumeFaces;
     if(opt->smoothNormals) addElementsInArrays(p, true);
-    addElementsInArrays(p, false);
+    addElementsInArrays(p, false, &volumeFaces);
 
     p->va_points->finalize();
     p->va_lines->finalize();
@@ -1596,6 +1607,15 @@ public:
     p->va_vectors->finalize();
     p->va_ellipses->finalize();
 
+    if(CTX::instance()->post.levelOfDetail) {
+      double cellSize = CTX::instance()->lc / CTX::instance()->post.levelOfDetail;
+      p->va_lines_lod = p->va_lines->decimate(cellSize);
+      // surface triangles are kept as-is: only the faces of volume elements
+      // that appear twice are removed
+      p->va_triangles_lod =
+        p->va_triangles->decimate(cellSize, true, &volumeFaces);
+    }
+
     Msg::Debug(
       "%d vertices in vertex arrays (%g Mb)",
       p->va_points->getNumVertices() + p->va_lines->getNumVertices() +
@@ -5,6 +5,7 @@
 
 #include <math.h>
 #include <list>
+#include <map>
 #include <set>
 #include <algorithm>
 #include "adaptiveData.h"
@@ -12,6 +13,7 @@
 #include "Plugin.h"
 #include "OS.h"
 #include "GmshDefines.h"
+#include "Context.h"
 
 //#define TIMER
 
@@ -1100,6 +1102,51 @@ template <class T> adaptiveElements<T>::~adaptiveElements()
   cleanElement<T>();
 }
 
+// number of elements refined together in adaptiveElements<T>::addInView(),
+// and maximum size (in number of doubles) of the refined geometry cached
+// between two calls
+static const int adaptiveElementBlockSize = 4096;
+static const std::size_t adaptiveMaxGeomCacheSize = 1 << 24;
+
+// compute C = A * B, where B (resp. C) stores numBlocks consecutive blocks of
+// blockSize columns of size A.size2() (resp. A.size1()); blocks are
+// distributed among threads in chunks
+static void multByBlocks(const fullMatrix<double> &A, std::vector<double> &B,
+                         std::vector<double> &C, int numBlocks, int blockSize,
+                         int nthreads)
+{
+  const int chunk = 256;
+  int numChunks = (numBlocks + chunk - 1) / chunk;
+  std::size_t sizeB = (std::size_t)A.size2() * blockSize;
+  std::size_t sizeC = (std::size_t)A.size1() * blockSize;
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+  for(int i = 0; i < numChunks; i++) {
+    int first = i * chunk, n = std::min(chunk, numBlocks - first);
+    fullMatrix<double> b(&B[first * sizeB], A.size2(), n * blockSize);
+    fullMatrix<double> c(&C[first * sizeC], A.size1(), n * blockSize);
+    A.mult(b, c);
+  }
+}
+
+template <class T> void adaptiveElements<T>::_initLeafNodes()
+{
+  std::map<const adaptiveVertex *, int> index;
+  int i = 0;
+  for(auto it = T::allVertices.begin(); it != T::allVertices.end(); ++it)
+    index[&(*it)] = i++;
+
+  _leafNodes.clear();
+  for(auto it = T::all.begin(); it != T::all.end(); it++) {
+    if((*it)->e[0]) continue;
+    for(int j = 0; j < T::numNodes; j++)
+      _leafNodes.push_back(index[(*it)->p[j]]);
+  }
+
+  // the reference interpolation has changed: the cached geometry is invalid
+  _geomIn.clear();
+  _geomOut.clear();
+}
+
 template <class T> void adaptiveElements<T>::init(int level)
 {
 #ifdef TIMER
@@ -1143,6 +1190,8 @@ template <class T> void adaptiveElements<T>::init(int level)
   if(tmpv) delete tmpv;
   if(tmpg) delete tmpg;
 
+  _initLeafNodes();
+
 #ifdef TIMER
   adaptiveData::timerInit += TimeOfDay() - t1;
   return;
@@ -1196,162 +1245,14 @@ template <> void adaptiveElements<adaptivePyramid>::init(int level)
   if(tmpv) delete tmpv;
   if(tmpg) delete tmpg;
 
+  _initLeafNodes();
+
 #ifdef TIMER
   adaptiveData::timerInit += TimeOfDay() - t1;
   return;
 #endif
 }
 
-template <class T>
-bool adaptiveElements<T>::adapt(double tol, int numComp,
-                                std::vector<PCoords> &coords,
-                                std::vector<PValues> &values, double &minVal,
-                                double &maxVal, GMSH_PostPlugin *plug,
-                                bool onlyComputeMinMax)
-{
-  int numVertices = T::allVertices.size();
-
-  if(!numVertices) {
-    Msg::Warning("No adapted vertices to interpolate");
-    return false;
-  }
-
-  int numVals = _coeffsVal ? _coeffsVal->size1() : T::numNodes;
-
-  if(numVals != (int)values.size()) {
-    Msg::Warning("Wrong number of values in adaptation %d != %i", numVals,
-                 values.size());
-    return false;
-  }
-
-#ifdef TIMER
-  double t1 = TimeOfDay();
-#endif
-
-  fullVector<double> val(numVals), res(numVertices);
-  switch(numComp) {
-  case 1: {
-    for(int i = 0; i < numVals; i++) val(i) = values[i].v[0];
-    break;
-  }
-  case 3:
-  case 9: {
-    for(int i = 0; i < numVals; i++) {
-      val(i) = 0;
-      for(int k = 0; k < numComp; k++)
-        val(i) += values[i].v[k] * values[i].v[k];
-    }
-    break;
-  }
-  default: {
-    Msg::Error("Can only adapt scalar, vector or tensor data");
-    return false;
-  }
-  }
-
-  _interpolVal->mult(val, res);
-
-  // minVal = VAL_INF;
-  // maxVal = -VAL_INF;
-  for(int i = 0; i < numVertices; i++) {
-    minVal = std::min(minVal, res(i));
-    maxVal = std::max(maxVal, res(i));
-  }
-  if(onlyComputeMinMax) return true;
-
-  fullMatrix<double> *resxyz = nullptr;
-  if(numComp == 3 || numComp == 9) {
-    fullMatrix<double> valxyz(numVals, numComp);
-    resxyz = new fullMatrix<double>(numVertices, numComp);
-    for(int i = 0; i < numVals; i++) {
-      for(int k = 0; k < numComp; k++) { valxyz(i, k) = values[i].v[k]; }
-    }
-    _interpolVal->mult(valxyz, *resxyz);
-  }
-
-  int numNodes = _coeffsGeom ? _coeffsGeom->size1() : T::numNodes;
-  if(numNodes != (int)coords.size()) {
-    Msg::Error("Wrong number of nodes in adaptation %d != %i", numNodes,
-               coords.size());
-    if(resxyz) delete resxyz;
-    return false;
-  }
-
-  fullMatrix<double> xyz(numNodes, 3), XYZ(numVertices, 3);
-  for(int i = 0; i < numNodes; i++) {
-    xyz(i, 0) = coords[i].c[0];
-    xyz(i, 1) = coords[i].c[1];
-    xyz(i, 2) = coords[i].c[2];
-  }
-  _interpolGeom->mult(xyz, XYZ);
-
-#ifdef TIMER
-  adaptiveData::timerAdapt += TimeOfDay() - t1;
-  return true;
-#endif
-
-  int i = 0;
-  for(auto it = T::allVertices.begin(); it != T::allVertices.end(); ++it) {
-    // ok because we know this will not change the set ordering
-    adaptiveVertex *p = (adaptiveVertex *)&(*it);
-    p->val = res(i);
-    if(resxyz) {
-      p->val = (*resxyz)(i, 0);
-      p->valy = (*resxyz)(i, 1);
-      p->valz = (*resxyz)(i, 2);
-      if(numComp == 9) {
-        p->valyx = (*resxyz)(i, 3);
-        p->valyy = (*resxyz)(i, 4);
-        p->valyz = (*resxyz)(i, 5);
-        p->valzx = (*resxyz)(i, 6);
-        p->valzy = (*resxyz)(i, 7);
-        p->valzz = (*resxyz)(i, 8);
-      }
-    }
-    p->X = XYZ(i, 0);
-    p->Y = XYZ(i, 1);
-    p->Z = XYZ(i, 2);
-    i++;
-  }
-
-  if(resxyz) delete resxyz;
-
-  for(auto it = T::all.begin(); it != T::all.end(); it++)
-    (*it)->visible = false;
-
-  if(!plug || tol != 0.) {
-    double avg = fabs(maxVal - minVal);
-    if(tol < 0) avg = 1.; // force visibility to the smallest subdivision
-    T::error(avg, tol);
-  }
-
-  if(plug) plug->assignSpecificVisibility();
-
-  coords.clear();
-  values.clear();
-  for(auto it = T::all.begin(); it != T::all.end(); it++) {
-    if((*it)->visible) {
-      adaptiveVertex **p = (*it)->p;
-      for(int i = 0; i < T::numNodes; i++) {
-        coords.push_back(PCoords(p[i]->X, p[i]->Y, p[i]->Z));
-        switch(numComp) {
-        case 1: values.push_back(PValues(p[i]->val)); break;
-        case 3:
-          values.push_back(PValues(p[i]->val, p[i]->valy, p[i]->valz));
-          break;
-        case 9:
-          values.push_back(PValues(p[i]->val, p[i]->valy, p[i]->valz,
-                                   p[i]->valyx, p[i]->valyy, p[i]->valyz,
-                                   p[i]->valzx, p[i]->valzy, p[i]->valzz));
-          break;
-        }
-      }
-    }
-  }
-
-  return true;
-}
-
 template <class T>
 void adaptiveElements<T>::addInView(double tol, int step, PViewData *in,
                                     PViewDataList *out, GMSH_PostPlugin *plug)
@@ -1424,73 +1325,232 @@ void adaptiveElements<T>::addInView(double tol, int step, PViewData *in,
   outList->clear();
   *outNb = 0;
 
-  for(int ent = 0; ent < in->getNumEntities(step); ent++) {
-    for(int ele = 0; ele < in->getNumElements(step, ent); ele++) {
-      if(in->skipElement(step, ent, ele) ||
-         in->getNumEdges(step, ent, ele) != T::numEdges)
-        continue;
-      int numNodes = in->getNumNodes(step, ent, ele);
-      std::vector<PCoords> coords;
-      for(int i = 0; i < numNodes; i++) {
-        double x, y, z;
-        in->getNode(step, ent, ele, i, x, y, z);
-        coords.push_back(PCoords(x, y, z));
-      }
-      int numVal = in->getNumValues(step, ent, ele);
-      std::vector<PValues> values;
+  int numVertices = _interpolVal ? _interpolVal->size1() : 0;
+  if(!numVertices) {
+    Msg::Warning("No adapted vertices to interpolate");
+    return;
+  }
+  int numVals = _interpolVal->size2();
+  int numNodes = _interpolGeom->size2();
+
+  // value columns per element: the components, followed for vectors and
+  // tensors by the squared norm (used for the min/max)
+  int numCols = (numComp == 1) ? 1 : numComp + 1;
+
+  // uniform refinement: the visible sub-elements are the finest ones whatever
+  // the values, so all the elements of a block can be processed in parallel;
+  // error-driven refinement (and plugin-driven visibility) work on the shared
+  // refinement tree in T::all, and are thus done one element at a time
+  bool uniform = (tol < 0 && !plug);
+  if(!uniform && (int)T::allVertices.size() != numVertices) {
+    Msg::Warning("Inconsistent number of adapted vertices %d != %d",
+                 (int)T::allVertices.size(), numVertices);
+    return;
+  }
+  int numLeaves = _leafNodes.size() / T::numNodes;
+  int numData = T::numNodes * (3 + numComp);
 
-      switch(numComp) {
-      case 1:
-        for(int i = 0; i < numVal; i++) {
-          double val;
-          in->getValue(step, ent, ele, i, val);
-          values.push_back(PValues(val));
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+
+#ifdef TIMER
+  double t1 = TimeOfDay();
+#endif
+
+  // the refined geometry does not depend on the time step: it is cached
+  // between calls, together with the input nodes it was computed from, unless
+  // it would be larger than adaptiveMaxGeomCacheSize
+  bool cacheGeom =
+    (std::size_t)numVertices * 3 * numEle <= adaptiveMaxGeomCacheSize;
+  if(!cacheGeom) {
+    std::vector<double>().swap(_geomIn);
+    std::vector<double>().swap(_geomOut);
+  }
+
+  // the elements are processed by blocks: the nodes and values of the
+  // elements of a block are gathered serially (PViewData is not thread-safe),
+  // stored column-wise, with one column per coordinate (resp. per value
+  // component) and per element, so that the refinement of the block is a
+  // matrix-matrix product with the reference interpolation matrices
+  std::vector<double> xyz, val, geom, res, minVal, maxVal;
+  std::size_t numDone = 0;
+  int numEntities = in->getNumEntities(step), ent = 0, ele = 0;
+  while(ent < numEntities) {
+    xyz.clear();
+    val.clear();
+    int numElements = 0;
+    for(; ent < numEntities; ent++, ele = 0) {
+      for(; ele < in->getNumElements(step, ent) &&
+            numElements < adaptiveElementBlockSize;
+          ele++) {
+        if(in->skipElement(step, ent, ele) ||
+           in->getNumEdges(step, ent, ele) != T::numEdges)
+          continue;
+        int nn = in->getNumNodes(step, ent, ele);
+        if(nn != numNodes) {
+          Msg::Error("Wrong number of nodes in adaptation %d != %i", numNodes,
+                     nn);
+          continue;
         }
-        break;
-      case 3: {
-        for(int i = 0; i < numVal / 3; i++) {
-          double vx, vy, vz;
-          in->getValue(step, ent, ele, 3 * i + 0, vx);
-          in->getValue(step, ent, ele, 3 * i + 1, vy);
-          in->getValue(step, ent, ele, 3 * i + 2, vz);
-          values.push_back(PValues(vx, vy, vz));
+        int nv = in->getNumValues(step, ent, ele) / numComp;
+        if(nv != numVals) {
+          Msg::Warning("Wrong number of values in adaptation %d != %i",
+                       numVals, nv);
+          continue;
         }
-        break;
+        std::size_t n = xyz.size();
+        xyz.resize(n + 3 * numNodes);
+        for(int i = 0; i < numNodes; i++)
+          in->getNode(step, ent, ele, i, xyz[n + i], xyz[n + numNodes + i],
+                      xyz[n + 2 * numNodes + i]);
+        n = val.size();
+        val.resize(n + numCols * numVals);
+        for(int i = 0; i < numVals; i++) {
+          double norm = 0.;
+          for(int k = 0; k < numComp; k++) {
+            double v;
+            in->getValue(step, ent, ele, numComp * i + k, v);
+            val[n + k * numVals + i] = v;
+            norm += v * v;
+          }
+          if(numComp > 1) val[n + numComp * numVals + i] = norm;
+        }
+        numElements++;
       }
-      case 9: {
-        for(int i = 0; i < numVal / 9; i++) {
-          double vxx, vxy, vxz, vyx, vyy, vyz, vzx, vzy, vzz;
-          in->getValue(step, ent, ele, 9 * i + 0, vxx);
-          in->getValue(step, ent, ele, 9 * i + 1, vxy);
-          in->getValue(step, ent, ele, 9 * i + 2, vxz);
-          in->getValue(step, ent, ele, 9 * i + 3, vyx);
-          in->getValue(step, ent, ele, 9 * i + 4, vyy);
-          in->getValue(step, ent, ele, 9 * i + 5, vyz);
-          in->getValue(step, ent, ele, 9 * i + 6, vzx);
-          in->getValue(step, ent, ele, 9 * i + 7, vzy);
-          in->getValue(step, ent, ele, 9 * i + 8, vzz);
-          values.push_back(
-            PValues(vxx, vxy, vxz, vyx, vyy, vyz, vzx, vzy, vzz));
+      if(numElements == adaptiveElementBlockSize) break;
+    }
+    if(!numElements) break;
+
+    // refined geometry of the block, from the cache if its nodes have not
+    // changed
+    const double *G = nullptr;
+    std::size_t in0 = numDone * 3 * numNodes;
+    std::size_t out0 = numDone * 3 * numVertices;
+    if(cacheGeom && _geomIn.size() >= in0 + xyz.size() &&
+       std::equal(xyz.begin(), xyz.end(), _geomIn.begin() + in0)) {
+      G = &_geomOut[out0];
+    }
+    else {
+      geom.resize((std::size_t)numVertices * 3 * numElements);
+      multByBlocks(*_interpolGeom, xyz, geom, numElements, 3, nthreads);
+      if(cacheGeom) {
+        if(_geomIn.size() < in0 + xyz.size()) {
+          _geomIn.resize(in0 + xyz.size());
+          _geomOut.resize(out0 + geom.size());
         }
-        break;
+        std::copy(xyz.begin(), xyz.end(), _geomIn.begin() + in0);
+        std::copy(geom.begin(), geom.end(), _geomOut.begin() + out0);
+      }
+      G = &geom[0];
+    }
+
+    res.resize((std::size_t)numVertices * numCols * numElements);
+    multByBlocks(*_interpolVal, val, res, numElements, numCols, nthreads);
+    numDone += numElements;
+
+    if(uniform) {
+      std::size_t o0 = outList->size();
+      outList->resize(o0 + (std::size_t)numElements * numLeaves * numData);
+      *outNb += numElements * numLeaves;
+      minVal.resize(numElements);
+      maxVal.resize(numElements);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+      for(int e = 0; e < numElements; e++) {
+        const double *X = G + (std::size_t)e * 3 * numVertices;
+        const double *V = &res[(std::size_t)e * numCols * numVertices];
+        const double *N = V + (numCols - 1) * numVertices;
+        minVal[e] = *std::min_element(N, N + numVertices);
+        maxVal[e] = *std::max_element(N, N + numVertices);
+        double *o = &(*outList)[o0 + (std::size_t)e * numLeaves * numData];
+        for(std::size_t i = 0; i < _leafNodes.size(); i += T::numNodes) {
+          const int *l = &_leafNodes[i];
+          for(int c = 0; c < 3; c++)
+            for(int k = 0; k < T::numNodes; k++)
+              *o++ = X[c * numVertices + l[k]];
+          for(int k = 0; k < T::numNodes; k++)
+            for(int c = 0; c < numComp; c++) *o++ = V[c * numVertices + l[k]];
+        }
+      }
+      for(int e = 0; e < numElements; e++) {
+        out->Min = std::min(out->Min, minVal[e]);
+        out->Max = std::max(out->Max, maxVal[e]);
+      }
+      continue;
+    }
+
+    for(int e = 0; e < numElements; e++) {
+      const double *X = G + (std::size_t)e * 3 * numVertices;
+      const double *V = &res[(std::size_t)e * numCols * numVertices];
+      const double *N = V + (numCols - 1) * numVertices;
+      int i = 0;
+      for(auto it = T::allVertices.begin(); it != T::allVertices.end(); ++it) {
+        // ok because we know this will not change the set ordering
+        adaptiveVertex *p = (adaptiveVertex *)&(*it);
+        p->val = V[i];
+        if(numComp == 3 || numComp == 9) {
+          p->valy = V[numVertices + i];
+          p->valz = V[2 * numVertices + i];
+        }
+        if(numComp == 9) {
+          p->valyx = V[3 * numVertices + i];
+          p->valyy = V[4 * numVertices + i];
+          p->valyz = V[5 * numVertices + i];
+          p->valzx = V[6 * numVertices + i];
+          p->valzy = V[7 * numVertices + i];
+          p->valzz = V[8 * numVertices + i];
+        }
+        p->X = X[i];
+        p->Y = X[numVertices + i];
+        p->Z = X[2 * numVertices + i];
+        out->Min = std::min(out->Min, N[i]);
+        out->Max = std::max(out->Max, N[i]);
+        i++;
       }
+
+      for(auto it = T::all.begin(); it != T::all.end(); it++)
+        (*it)->visible = false;
+
+      if(!plug || tol != 0.) {
+        double avg = fabs(out->Max - out->Min);
+        if(tol < 0) avg = 1.; // force visibility to the smallest subdivision
+        T::error(avg, tol);
       }
-      if(adapt(tol, numComp, coords, values, out->Min, out->Max, plug)) {
-        *outNb += coords.size() / T::numNodes;
-        for(std::size_t i = 0; i < coords.size() / T::numNodes; i++) {
-          for(int k = 0; k < T::numNodes; ++k)
-            outList->push_back(coords[T::numNodes * i + k].c[0]);
-          for(int k = 0; k < T::numNodes; ++k)
-            outList->push_back(coords[T::numNodes * i + k].c[1]);
-          for(int k = 0; k < T::numNodes; ++k)
-            outList->push_back(coords[T::numNodes * i + k].c[2]);
-          for(int k = 0; k < T::numNodes; ++k)
-            for(int l = 0; l < numComp; ++l)
-              outList->push_back(values[T::numNodes * i + k].v[l]);
+
+      if(plug) plug->assignSpecificVisibility();
+
+      for(auto it = T::all.begin(); it != T::all.end(); it++) {
+        if(!(*it)->visible) continue;
+        adaptiveVertex **p = (*it)->p;
+        (*outNb)++;
+        for(int k = 0; k < T::numNodes; ++k) outList->push_back(p[k]->X);
+        for(int k = 0; k < T::numNodes; ++k) outList->push_back(p[k]->Y);
+        for(int k = 0; k < T::numNodes; ++k) outList->push_back(p[k]->Z);
+        for(int k = 0; k < T::numNodes; ++k) {
+          outList->push_back(p[k]->val);
+          if(numComp == 1) continue;
+          outList->push_back(p[k]->valy);
+          outList->push_back(p[k]->valz);
+          if(numComp == 3) continue;
+          outList->push_back(p[k]->valyx);
+          outList->push_back(p[k]->valyy);
+          outList->push_back(p[k]->valyz);
+          outList->push_back(p[k]->valzx);
+          outList->push_back(p[k]->valzy);
+          outList->push_back(p[k]->valzz);
         }
       }
     }
   }
+
+  // drop the cached geometry of the elements that are no longer in the view
+  if(cacheGeom && _geomIn.size() > numDone * 3 * numNodes) {
+    _geomIn.resize(numDone * 3 * numNodes);
+    _geomOut.resize(numDone * 3 * numVertices);
+  }
+
+#ifdef TIMER
+  adaptiveData::timerAdapt += TimeOfDay() - t1;
+#endif
 }
 
 adaptiveData::adaptiveData(PViewData *data, bool outDataInit)
@@ -597,6 +597,15 @@ template <class T> class adaptiveElements {
 private:
   fullMatrix<double> *_coeffsVal, *_eexpsVal, *_interpolVal;
   fullMatrix<double> *_coeffsGeom, *_eexpsGeom, *_interpolGeom;
+  // indices in T::allVertices of the nodes of the finest sub-elements, i.e.
+  // the sub-elements that are visible when refinement is uniform
+  std::vector<int> _leafNodes;
+  // nodal coordinates of the elements processed by the last call to
+  // addInView, and their refined counterpart: the refined geometry does not
+  // depend on the time step, and is reused as long as the input nodes do not
+  // change (if it is not too large)
+  std::vector<double> _geomIn, _geomOut;
+  void _initLeafNodes();
 
 public:
   adaptiveElements(std::vector<fullMatrix<double> *> &interpolationMatrices);
@@ -604,11 +613,6 @@ public:
   // create the _interpolVal and _interpolGeom matrices at the given
   // refinement level
   void init(int level);
-  // process the element data in coords/values and return the refined
-  // elements in coords/values
-  bool adapt(double tol, int numComp, std::vector<PCoords> &coords,
-             std::vector<PValues> &values, double &minVal, double &maxVal,
-             GMSH_PostPlugin *plug = nullptr, bool onlyComputeMinMax = false);
   // adapt all the T-type elements in the input view and add the
   // refined elements in the output view (we will remove this when we
   // switch to true on-the-fly local refinement in drawPost())
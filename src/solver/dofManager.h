@@ -6,10 +6,12 @@
 #ifndef DOF_MANAGER_H
 #define DOF_MANAGER_H
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <complex>
 #include <map>
+#include <unordered_map>
 #include <list>
 #include <iostream>
 #include "MVertex.h"
@@ -47,6 +49,16 @@ public:
   }
 };
 
+// hash of a Dof (entity tag x type), used for the numbering tables of the
+// dofManager, which are looked up several times per assembled matrix entry
+struct DofHash {
+  std::size_t operator()(const Dof &d) const
+  {
+    return (std::size_t)d.getEntity() * (std::size_t)2654435761u ^
+           (std::size_t)d.getType();
+  }
+};
+
 template <class T> struct dofTraits {
   typedef T VecType;
   typedef T MatType;
@@ -86,10 +98,10 @@ public:
 class dofManagerBase {
 protected:
   // numbering of unknown dof blocks
-  std::map<Dof, int> unknown;
+  std::unordered_map<Dof, int, DofHash> unknown;
 
   // associatations (not used ?)
-  std::map<Dof, Dof> associatedWith;
+  std::unordered_map<Dof, Dof, DofHash> associatedWith;
 
   // parallel section
   // those dof are images of ghost located on another proc (id givent by the
@@ -123,7 +135,7 @@ protected:
 
   // fixations on full blocks, treated by eliminating equations:
   //   DofVec = dataVec
-  std::map<Dof, dataVec> fixed;
+  std::unordered_map<Dof, dataVec, DofHash> fixed;
 
   // initial conditions (not used ?)
   std::map<Dof, std::vector<dataVec> > initial;
@@ -132,7 +144,7 @@ protected:
   linearSystem<dataMat> *_current;
   std::map<const std::string, linearSystem<dataMat> *> _linearSystems;
 
-  std::map<Dof, T> ghostValue;
+  std::unordered_map<Dof, T, DofHash> ghostValue;
 
 public:
   void scatterSolution();
@@ -212,21 +224,23 @@ public:
   }
   virtual inline void numberDof(Dof key)
   {
-    if(associatedWith.find(key) != associatedWith.end()) return;
-    if(fixed.find(key) != fixed.end()) return;
-    if(constraints.find(key) != constraints.end()) return;
-    if(ghostByDof.find(key) != ghostByDof.end()) return;
-
-    auto it = unknown.find(key);
-    if(it == unknown.end()) {
-      std::size_t size = unknown.size();
-      unknown[key] = size;
-    }
+    if(!associatedWith.empty() &&
+       associatedWith.find(key) != associatedWith.end())
+      return;
+    if(!fixed.empty() && fixed.find(key) != fixed.end()) return;
+    if(!constraints.empty() && constraints.find(key) != constraints.end())
+      return;
+    if(!ghostByDof.empty() && ghostByDof.find(key) != ghostByDof.end()) return;
+    std::size_t size = unknown.size();
+    unknown.insert(std::make_pair(key, (int)size));
   }
   virtual inline void numberDof(const std::vector<Dof> &R)
   {
     for(std::size_t i = 0; i < R.size(); i++) this->numberDof(R[i]);
   }
+  // reserve space for numDofs unknowns before numbering dofs in bulk (e.g.
+  // the number of nodes times the number of components), to avoid rehashing
+  inline void reserveDofs(std::size_t numDofs) { unknown.reserve(numDofs); }
   inline void numberDof(long int ent, int type) { numberDof(Dof(ent, type)); }
   inline void numberVertex(MVertex *v, int iComp, int iField)
   {
@@ -260,7 +274,7 @@ public:
 
   virtual inline void getFixedDofValue(Dof key, dataVec &val) const
   {
-    typename std::map<Dof, dataVec>::const_iterator it = fixed.find(key);
+    auto it = fixed.find(key);
     if(it != fixed.end()) {
       val = it->second;
     }
@@ -285,7 +299,7 @@ public:
       }
     }
     {
-      typename std::map<Dof, dataVec>::const_iterator it = ghostValue.find(key);
+      auto it = ghostValue.find(key);
       if(it != ghostValue.end()) {
         val = it->second;
         return;
@@ -299,7 +313,7 @@ public:
       }
     }
     {
-      typename std::map<Dof, dataVec>::const_iterator it = fixed.find(key);
+      auto it = fixed.find(key);
       if(it != fixed.end()) {
         val = it->second;
         return;
@@ -369,7 +383,7 @@ public:
         _current->insertInSparsityPattern(itR->second, itC->second);
       }
       else {
-        typename std::map<Dof, dataVec>::iterator itFixed = fixed.find(C);
+        auto itFixed = fixed.find(C);
         if(itFixed != fixed.end()) {
         }
         else
@@ -383,9 +397,19 @@ public:
 
   virtual inline void sparsityDof(const std::vector<Dof> &keys)
   {
+    if(_isParallel && !_parallelFinalized) _parallelFinalize();
+    if(!_current->isAllocated()) _current->allocate(sizeOfR());
+    std::vector<int> N(keys.size());
+    for(std::size_t i = 0; i < keys.size(); i++) {
+      auto it = unknown.find(keys[i]);
+      N[i] = (it != unknown.end()) ? it->second : -1;
+    }
     for(std::size_t itR = 0; itR < keys.size(); itR++) {
       for(std::size_t itC = 0; itC < keys.size(); itC++) {
-        insertInSparsityPattern(keys[itR], keys[itC]);
+        if(N[itR] != -1 && N[itC] != -1)
+          _current->insertInSparsityPattern(N[itR], N[itC]);
+        else
+          insertInSparsityPattern(keys[itR], keys[itC]);
       }
     }
   }
@@ -401,7 +425,7 @@ public:
         _current->addToMatrix(itR->second, itC->second, value);
       }
       else {
-        typename std::map<Dof, dataVec>::iterator itFixed = fixed.find(C);
+        auto itFixed = fixed.find(C);
         if(itFixed != fixed.end()) {
           // tmp = -value * itFixed->second
           dataVec tmp(itFixed->second);
@@ -416,56 +440,52 @@ public:
       assembleLinConst(R, C, value);
     }
   }
-  virtual inline void assemble(std::vector<Dof> &R, std::vector<Dof> &C,
-                               const fullMatrix<dataMat> &m)
+  // resolve, with a single lookup per dof, the numbers NR of the dofs R in
+  // the linear system (-1 if the dof is not an unknown) and the values FR of
+  // the fixed dofs (nullptr if the dof is not fixed); associated dofs are
+  // replaced in R
+  inline void getDofNumbers(std::vector<Dof> &R, std::vector<int> &NR,
+                            std::vector<const dataVec *> &FR)
   {
-    if(_isParallel && !_parallelFinalized) _parallelFinalize();
-    if(!_current->isAllocated()) _current->allocate(sizeOfR());
-    printf("coucou\n");
-
-    for(std::size_t i = 0; i < R.size(); i++) {
-      auto it = associatedWith.find(R[i]);
-      if (it != associatedWith.end())R[i] = it->second;
-    }
-    for(std::size_t i = 0; i < C.size(); i++) {
-      auto it = associatedWith.find(C[i]);
-      if (it != associatedWith.end())C[i] = it->second;
-    }
-    
-    std::vector<int> NR(R.size()), NC(C.size());
-
+    NR.resize(R.size());
+    FR.resize(R.size());
     for(std::size_t i = 0; i < R.size(); i++) {
+      if(!associatedWith.empty()) {
+        auto it = associatedWith.find(R[i]);
+        if(it != associatedWith.end()) R[i] = it->second;
+      }
+      FR[i] = nullptr;
       auto itR = unknown.find(R[i]);
-      if(itR != unknown.end())
+      if(itR != unknown.end()) {
         NR[i] = itR->second;
-      else
-        NR[i] = -1;
-    }
-    for(std::size_t i = 0; i < C.size(); i++) {
-      auto itC = unknown.find(C[i]);
-      if(itC != unknown.end())
-        NC[i] = itC->second;
-      else
-        NC[i] = -1;
+        continue;
+      }
+      NR[i] = -1;
+      auto itFixed = fixed.find(R[i]);
+      if(itFixed != fixed.end()) FR[i] = &itFixed->second;
     }
+  }
+  // assemble the element block m for the test dofs R and the trial dofs C,
+  // once all the dof numbers have been resolved with getDofNumbers
+  inline void assemble(const std::vector<Dof> &R, const std::vector<int> &NR,
+                       const std::vector<Dof> &C, const std::vector<int> &NC,
+                       const std::vector<const dataVec *> &FC,
+                       const fullMatrix<dataMat> &m)
+  {
+    if(_isParallel && !_parallelFinalized) _parallelFinalize();
+    if(!_current->isAllocated()) _current->allocate(sizeOfR());
     for(std::size_t i = 0; i < R.size(); i++) {
       if(NR[i] != -1) {
         for(std::size_t j = 0; j < C.size(); j++) {
-          if(NC[j] != -1) {
-            _current->addToMatrix(NR[i], NC[j], m(i, j));
-          }
-          else {
-            typename std::map<Dof, dataVec>::iterator itFixed =
-              fixed.find(C[j]);
-            if(itFixed != fixed.end()) {
-              // tmp = -m(i,j) * itFixed->second
-              dataVec tmp(itFixed->second);
-              dofTraits<T>::gemm(tmp, m(i, j), itFixed->second, -1, 0);
-              _current->addToRightHandSide(NR[i], tmp);
-            }
-            else
-              assembleLinConst(R[i], C[j], m(i, j));
+          if(NC[j] != -1) { _current->addToMatrix(NR[i], NC[j], m(i, j)); }
+          else if(FC[j]) {
+            // tmp = -m(i,j) * fixed value
+            dataVec tmp(*FC[j]);
+            dofTraits<T>::gemm(tmp, m(i, j), *FC[j], -1, 0);
+            _current->addToRightHandSide(NR[i], tmp);
           }
+          else
+            assembleLinConst(R[i], C[j], m(i, j));
         }
       }
       else {
@@ -475,28 +495,24 @@ public:
       }
     }
   }
+  virtual inline void assemble(std::vector<Dof> &R, std::vector<Dof> &C,
+                               const fullMatrix<dataMat> &m)
+  {
+    std::vector<int> NR, NC;
+    std::vector<const dataVec *> FR, FC;
+    getDofNumbers(R, NR, FR);
+    getDofNumbers(C, NC, FC);
+    assemble(R, NR, C, NC, FC, m);
+  }
   // for linear forms
   virtual inline void assemble(std::vector<Dof> &R,
                                const fullVector<dataMat> &m)
   {
     if(_isParallel && !_parallelFinalized) _parallelFinalize();
     if(!_current->isAllocated()) _current->allocate(sizeOfR());
-    printf("coucou RHS\n");
-
-    for(std::size_t i = 0; i < R.size(); i++) {
-      auto it = associatedWith.find(R[i]);
-      if (it != associatedWith.end())R[i] = it->second;
-    }
-
-
-    std::vector<int> NR(R.size());
-    for(std::size_t i = 0; i < R.size(); i++) {
-      auto itR = unknown.find(R[i]);
-      if(itR != unknown.end())
-        NR[i] = itR->second;
-      else
-        NR[i] = -1;
-    }
+    std::vector<int> NR;
+    std::vector<const dataVec *> FR;
+    getDofNumbers(R, NR, FR);
     for(std::size_t i = 0; i < R.size(); i++) {
       if(NR[i] != -1) {
         _current->addToRightHandSide(NR[i], m(i));
@@ -519,47 +535,10 @@ public:
   virtual inline void assemble(std::vector<Dof> &R,
                                const fullMatrix<dataMat> &m)
   {
-    if(_isParallel && !_parallelFinalized) _parallelFinalize();
-    if(!_current->isAllocated()) _current->allocate(sizeOfR());
-    for(std::size_t i = 0; i < R.size(); i++) {
-      auto it = associatedWith.find(R[i]);
-      if (it != associatedWith.end())R[i] = it->second;
-    }
-
-    std::vector<int> NR(R.size());
-    for(std::size_t i = 0; i < R.size(); i++) {
-      auto itR = unknown.find(R[i]);
-      if(itR != unknown.end())
-        NR[i] = itR->second;
-      else
-        NR[i] = -1;
-    }
-    for(std::size_t i = 0; i < R.size(); i++) {
-      if(NR[i] != -1) {
-        for(std::size_t j = 0; j < R.size(); j++) {
-          if(NR[j] != -1) {
-            _current->addToMatrix(NR[i], NR[j], m(i, j));
-          }
-          else {
-            typename std::map<Dof, dataVec>::iterator itFixed =
-              fixed.find(R[j]);
-            if(itFixed != fixed.end()) {
-              // tmp = -m(i,j) * itFixed->second
-              dataVec tmp(itFixed->second);
-              dofTraits<T>::gemm(tmp, m(i, j), itFixed->second, -1, 0);
-              _current->addToRightHandSide(NR[i], tmp);
-            }
-            else
-              assembleLinConst(R[i], R[j], m(i, j));
-          }
-        }
-      }
-      else {
-        for(std::size_t j = 0; j < R.size(); j++) {
-          assembleLinConst(R[i], R[j], m(i, j));
-        }
-      }
-    }
+    std::vector<int> NR;
+    std::vector<const dataVec *> FR;
+    getDofNumbers(R, NR, FR);
+    assemble(R, NR, R, NR, FR, m);
   }
   inline void assemble(int entR, int typeR, int entC, int typeC,
                        const dataMat &value)
@@ -691,16 +670,16 @@ public:
   {
     R.clear();
     R.reserve(fixed.size());
-    typename std::map<Dof, dataVec>::iterator it;
-    for(it = fixed.begin(); it != fixed.end(); ++it) {
+    for(auto it = fixed.begin(); it != fixed.end(); ++it) {
       R.push_back(it->first);
     }
+    // fixed is a hash table: return the dofs in their usual order
+    std::sort(R.begin(), R.end());
   }
   virtual void getFixedDof(std::set<Dof> &R)
   {
     R.clear();
-    typename std::map<Dof, dataVec>::iterator it;
-    for(it = fixed.begin(); it != fixed.end(); ++it) {
+    for(auto it = fixed.begin(); it != fixed.end(); ++it) {
       R.insert(it->first);
     }
   }
@@ -520,6 +520,7 @@ void elasticitySolver::assemble(linearSystem<double> *lsys)
                LagrangeMultiplierFields[i].g->end(), *pAssembler);
   }
   // Elastic Fields
+  pAssembler->reserveDofs(_dim * pModel->getNumMeshVertices());
   for(std::size_t i = 0; i < elasticFields.size(); ++i) {
     if(elasticFields[i]._e != 0.)
       NumberDofs(*LagSpace, elasticFields[i].g->begin(),
@@ -531,6 +532,16 @@ void elasticitySolver::assemble(linearSystem<double> *lsys)
       FixVoidNodalDofs(*LagSpace, elasticFields[i].g->begin(),
                        elasticFields[i].g->end(), *pAssembler);
   }
+  // Sparsity pattern of the elastic terms, so that the matrix is allocated
+  // once (the cross terms of Lagrange multipliers are not covered); the keys
+  // of the Lagrange space can be computed in parallel
+  if(LagrangeMultiplierFields.empty()) {
+    for(std::size_t i = 0; i < elasticFields.size(); ++i) {
+      if(elasticFields[i]._e != 0.)
+        SparsityDofs(*LagSpace, elasticFields[i].g->begin(),
+                     elasticFields[i].g->end(), *pAssembler, true);
+    }
+  }
   // Neumann conditions
   GaussQuadrature Integ_Boundary(GaussQuadrature::Val);
 
@@ -577,8 +588,9 @@ void elasticitySolver::assemble(linearSystem<double> *lsys)
     printf("Elastic\n");
     IsotropicElasticTerm Eterm(*LagSpace, elasticFields[i]._e,
                                elasticFields[i]._nu);
+    // the elastic term and the Lagrange space are thread-safe
     Assemble(Eterm, *LagSpace, elasticFields[i].g->begin(),
-             elasticFields[i].g->end(), Integ_Bulk, *pAssembler);
+             elasticFields[i].g->end(), Integ_Bulk, *pAssembler, true);
   }
 
   printf("nDofs=%d\n", pAssembler->sizeOfR());
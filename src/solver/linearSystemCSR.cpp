@@ -10,6 +10,7 @@
 #include "GmshConfig.h"
 #include "GmshMessage.h"
 #include "linearSystemCSR.h"
+#include "Context.h"
 #include "OS.h"
 
 #define SWAP(a, b)                                                             \
@@ -434,11 +435,85 @@ void linearSystemCSR<std::complex<double> >::getMatrix(INDEX_TYPE *&jptr,
   sorted = true;
 }
 
+template <class scalar>
+static void _matMult(int n, const INDEX_TYPE *jptr, const INDEX_TYPE *ai,
+                     const scalar *a, const std::vector<scalar> &b,
+                     std::vector<scalar> &x)
+{
+  int nthreads = CTX::instance()->numThreads;
+  if(!nthreads) nthreads = Msg::GetMaxThreads();
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+  for(int i = 0; i < n; i++) {
+    scalar sum = scalar();
+    for(INDEX_TYPE j = jptr[i]; j < jptr[i + 1]; j++) sum += a[j] * b[ai[j]];
+    x[i] = sum;
+  }
+}
+
+template <> int linearSystemCSR<double>::matMult()
+{
+  if(!_a) return 0;
+  INDEX_TYPE *jptr, *ai;
+  double *a;
+  getMatrix(jptr, ai, a);
+  _matMult(_b->size(), jptr, ai, a, *_b, *_x);
+  return 1;
+}
+
+template <> int linearSystemCSR<std::complex<double> >::matMult()
+{
+  if(!_a) return 0;
+  INDEX_TYPE *jptr, *ai;
+  double *a;
+  getMatrix(jptr, ai, a);
+  _matMult(_b->size(), jptr, ai, (std::complex<double> *)a, *_b, *_x);
+  return 1;
+}
+
 #if defined(HAVE_GMM)
 
 #undef BB // can be defined by FlGui.h, and clashes with gmm arg name
 #include "gmm.h"
 
+// CSR matrix seen as a linear operator by the Gmm++ iterative solvers, so
+// that their matrix-vector products use the row-parallel kernel (the products
+// are found by argument-dependent lookup in gmm::gmres and gmm::cg)
+class csrOperator {
+public:
+  int n;
+  const INDEX_TYPE *jptr, *ai;
+  const double *a;
+  csrOperator(int nn, const INDEX_TYPE *j, const INDEX_TYPE *i, const double *v)
+    : n(nn), jptr(j), ai(i), a(v)
+  {
+  }
+};
+
+// x = A*b
+static void mult(const csrOperator &A, const std::vector<double> &b,
+                 std::vector<double> &x)
+{
+  _matMult(A.n, A.jptr, A.ai, A.a, b, x);
+}
+
+template <class V1>
+static void mult(const csrOperator &A, const V1 &b, std::vector<double> &x)
+{
+  std::vector<double> tmp(gmm::vect_size(b));
+  gmm::copy(b, tmp);
+  _matMult(A.n, A.jptr, A.ai, A.a, tmp, x);
+}
+
+// x = A*b + c
+template <class V1, class V2>
+static void mult(const csrOperator &A, const V1 &b, const V2 &c,
+                 std::vector<double> &x)
+{
+  std::vector<double> tmp(A.n);
+  mult(A, b, tmp);
+  gmm::add(tmp, c, x);
+}
+
 template <> int linearSystemCSRGmm<double>::systemSolve()
 {
   if(!sorted)
@@ -455,12 +530,14 @@ template <> int linearSystemCSRGmm<double>::systemSolve()
 
   //gmm::ildltt_precond<gmm::csr_matrix<double, 0> > P(M, 10, 1.e-10);
   gmm::ilu_precond<gmm::csr_matrix<double> > P(M);
+  csrOperator A(_b->size(), (INDEX_TYPE *)_jptr->array,
+                (INDEX_TYPE *)_ai->array, (double *)_a->array);
   gmm::iteration iter(_tol);
   iter.set_noisy(_noisy);
   if(_method == "gmres")
-    gmm::gmres(M, *_x, *_b, P, 100, iter);
+    gmm::gmres(A, *_x, *_b, P, 100, iter);
   else
-    gmm::cg(M, *_x, *_b, P, iter);
+    gmm::cg(A, *_x, *_b, P, iter);
   if(!iter.converged())
     Msg::Warning("Iterative linear solver has not converged (res = %g)",
                  iter.get_res());
@@ -84,6 +84,11 @@ public:
           break;
         }
       }
+      // the entry is not in the preallocated pattern: go back to the linked
+      // list representation (the rows are chained in order, and will be
+      // sorted again when needed), appending the entry at the end of the row
+      sorted = false;
+      position = jptr[il + 1] - 1;
     }
     else if(something[il]) {
       while(1) {
@@ -117,6 +122,9 @@ public:
       ptr[position] = n;
   }
   virtual void getMatrix(INDEX_TYPE *&jptr, INDEX_TYPE *&ai, double *&a);
+  // x = A*b, parallelized over the rows (this kernel is also used for the
+  // products in the iterative solvers of linearSystemCSRGmm)
+  virtual int matMult();
 
   virtual void getFromMatrix(int row, int col, scalar &val) const
   {
@@ -19,8 +19,15 @@ bool linearSystemEigen<double>::isAllocated() const
     return false;
 }
 
+void linearSystemEigen<double>::_matrixChanged()
+{
+  if(_lu) _lu.reset();
+}
+
 void linearSystemEigen<double>::allocate(int nbRows)
 {
+  _matrixChanged();
+  _nnzPerColumn.clear();
   A.resize(nbRows, nbRows);
   B.resize(nbRows);
   X.resize(nbRows);
@@ -30,6 +37,7 @@ void linearSystemEigen<double>::allocate(int nbRows)
 
 void linearSystemEigen<double>::clear()
 {
+  _matrixChanged();
   A.setZero();
   B.setZero();
   X.setZero();
@@ -37,6 +45,7 @@ void linearSystemEigen<double>::clear()
 
 void linearSystemEigen<double>::zeroMatrix()
 {
+  _matrixChanged();
   A.setZero();
   B.setZero();
   X.setZero();
@@ -81,14 +90,20 @@ int linearSystemEigen<double>::systemSolve()
     }
   }
   else if(solverType == EigenSparseLU) {
-    Eigen::SparseLU<Eigen::SparseMatrix<double> > solver;
-    solver.compute(A);
-    if(solver.info() != Eigen::ComputationInfo::Success) {
-      Msg::Warning("Eigen: failed to solve linear system with SparseLU");
-      return -1;
+    // the factorization is reused if the matrix has not changed since the
+    // last solve
+    if(!_lu) {
+      _lu.reset(new Eigen::SparseLU<Eigen::SparseMatrix<double> >);
+      A.makeCompressed();
+      _lu->compute(A);
+      if(_lu->info() != Eigen::ComputationInfo::Success) {
+        Msg::Warning("Eigen: failed to solve linear system with SparseLU");
+        _lu.reset();
+        return -1;
+      }
     }
-    X = solver.solve(B);
-    if(solver.info() != Eigen::ComputationInfo::Success) {
+    X = _lu->solve(B);
+    if(_lu->info() != Eigen::ComputationInfo::Success) {
       Msg::Warning("Eigen: failed to solve linear system with SparseLU");
       return -1;
     }
@@ -154,7 +169,12 @@ int linearSystemEigen<double>::systemSolve()
   return 1;
 }
 
-void linearSystemEigen<double>::insertInSparsityPattern(int row, int col) {}
+void linearSystemEigen<double>::insertInSparsityPattern(int row, int col)
+{
+  if(col < 0 || col >= A.cols()) return;
+  if(_nnzPerColumn.empty()) _nnzPerColumn.resize(A.cols(), 0);
+  _nnzPerColumn[col]++;
+}
 
 double linearSystemEigen<double>::normInfRightHandSide() const
 {
@@ -168,7 +188,12 @@ double linearSystemEigen<double>::normInfSolution() const
 
 void linearSystemEigen<double>::addToMatrix(int row, int col, const double &val)
 {
-  A.coeffRef(row, col) += val; /* slow ! */
+  _matrixChanged();
+  if(!_nnzPerColumn.empty()) {
+    A.reserve(_nnzPerColumn);
+    _nnzPerColumn.clear();
+  }
+  A.coeffRef(row, col) += val; /* slow if the sparsity pattern is unknown ! */
 }
 
 void linearSystemEigen<double>::getFromMatrix(int row, int col,
@@ -14,6 +14,8 @@
 
 #if defined(HAVE_EIGEN)
 
+#include <memory>
+#include <vector>
 #include <Eigen/Sparse>
 
 template <class scalar> class linearSystemEigen : public linearSystem<scalar> {
@@ -60,6 +62,14 @@ private:
   Eigen::VectorXd B;
   Eigen::SparseMatrix<double> A;
   linearSystemEigenSolver solverType;
+  // number of entries per column declared through insertInSparsityPattern,
+  // used to reserve the storage of A before the first addToMatrix
+  std::vector<int> _nnzPerColumn;
+  // sparse LU factorization of A, kept between successive calls to
+  // systemSolve as long as the matrix is not modified (e.g. to solve for
+  // several right-hand sides)
+  std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double> > > _lu;
+  void _matrixChanged();
 
 public:
   linearSystemEigen();
@@ -14,24 +14,78 @@
 #include "terms.h"
 #include "quadratureRules.h"
 #include "MVertex.h"
+#include "Context.h"
+#include "GmshMessage.h"
 
+// Process the elements in [itbegin, itend) by blocks: the element
+// contributions (local matrix or vector) and the keys of the elements of a
+// block are computed with compute(e, npts, GP, local, keys), then passed
+// serially to scatter(local, keys) in the order of the elements. If parallel
+// is set, compute() is called concurrently on the elements of a block, using
+// General.NumThreads threads: it must then be thread-safe. The linear systems
+// are not thread-safe, and scattering in order gives the same system whatever
+// the number of threads. The integration points are computed serially, as the
+// quadrature rules can be built on the fly.
+template <class Local, class Iterator, class Compute, class Scatter>
+void AssembleByBlocks(Iterator itbegin, Iterator itend,
+                      QuadratureBase &integrator, bool parallel,
+                      Compute compute, Scatter scatter)
+{
+  int nthreads = 1;
+  if(parallel) {
+    nthreads = CTX::instance()->numThreads;
+    if(!nthreads) nthreads = Msg::GetMaxThreads();
+  }
+  const std::size_t blockSize = (nthreads > 1) ? 256 : 1;
+  std::vector<MElement *> elements;
+  std::vector<int> npts;
+  std::vector<IntPt *> GP;
+  std::vector<Local> local(blockSize);
+  std::vector<std::vector<Dof> > keys(blockSize);
+  Iterator it = itbegin;
+  while(it != itend) {
+    elements.clear();
+    npts.clear();
+    GP.clear();
+    for(; it != itend && elements.size() < blockSize; ++it) {
+      MElement *e = *it;
+      IntPt *pts = nullptr;
+      npts.push_back(integrator.getIntPoints(e, &pts));
+      GP.push_back(pts);
+      elements.push_back(e);
+    }
+    const int n = elements.size();
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads) if(n > 1)
+    for(int k = 0; k < n; k++) {
+      keys[k].clear();
+      compute(elements[k], npts[k], GP[k], local[k], keys[k]);
+    }
+    for(int k = 0; k < n; k++) scatter(local[k], keys[k]);
+  }
+}
+
+// Symmetric assembly. If parallel is set, term.get() and space.getKeys() are
+// called concurrently on different elements (see AssembleByBlocks): only set
+// it if both are thread-safe, e.g. for an IsotropicElasticTerm on a
+// VectorLagrangeFunctionSpace. Terms or spaces that keep a state per element
+// (e.g. the enrichment of an xFemFunctionSpace) or that evaluate user
+// functions must be assembled serially.
 template <class Iterator, class Assembler>
 void Assemble(BilinearTermBase &term, FunctionSpaceBase &space,
               Iterator itbegin, Iterator itend, QuadratureBase &integrator,
-              Assembler &assembler)
-// symmetric
+              Assembler &assembler, bool parallel = false)
 {
-  fullMatrix<typename Assembler::dataMat> localMatrix;
-  std::vector<Dof> R;
-  for(Iterator it = itbegin; it != itend; ++it) {
-    MElement *e = *it;
-    R.clear();
-    IntPt *GP;
-    int npts = integrator.getIntPoints(e, &GP);
-    term.get(e, npts, GP, localMatrix); // localMatrix.print();
-    space.getKeys(e, R);
-    assembler.assemble(R, localMatrix);
-  }
+  typedef fullMatrix<typename Assembler::dataMat> Local;
+  AssembleByBlocks<Local>(
+    itbegin, itend, integrator, parallel,
+    [&](MElement *e, int npts, IntPt *GP, Local &localMatrix,
+        std::vector<Dof> &R) {
+      term.get(e, npts, GP, localMatrix);
+      space.getKeys(e, R);
+    },
+    [&](const Local &localMatrix, std::vector<Dof> &R) {
+      assembler.assemble(R, localMatrix);
+    });
 }
 
 template <class Iterator, class Assembler>
@@ -115,22 +169,23 @@ void Assemble(BilinearTermBase &term, FunctionSpaceBase &shapeFcts,
   }
 }
 
+// Same thread-safety requirements as for the symmetric bilinear assembly
 template <class Iterator, class Assembler>
 void Assemble(LinearTermBase<double> &term, FunctionSpaceBase &space,
               Iterator itbegin, Iterator itend, QuadratureBase &integrator,
-              Assembler &assembler)
+              Assembler &assembler, bool parallel = false)
 {
-  fullVector<typename Assembler::dataMat> localVector;
-  std::vector<Dof> R;
-  for(Iterator it = itbegin; it != itend; ++it) {
-    MElement *e = *it;
-    R.clear();
-    IntPt *GP;
-    int npts = integrator.getIntPoints(e, &GP);
-    term.get(e, npts, GP, localVector); // localVector.print();
-    space.getKeys(e, R);
-    assembler.assemble(R, localVector);
-  }
+  typedef fullVector<typename Assembler::dataMat> Local;
+  AssembleByBlocks<Local>(
+    itbegin, itend, integrator, parallel,
+    [&](MElement *e, int npts, IntPt *GP, Local &localVector,
+        std::vector<Dof> &R) {
+      term.get(e, npts, GP, localVector);
+      space.getKeys(e, R);
+    },
+    [&](const Local &localVector, std::vector<Dof> &R) {
+      assembler.assemble(R, localVector);
+    });
 }
 
 template <class Iterator, class Assembler>
@@ -310,16 +365,33 @@ void FixVoidNodalDofs(FunctionSpaceBase &space, Iterator itbegin,
   FixNodalDofs(space, itbegin, itend, assembler, fct, filter);
 }
 
+// Insert the entries coupling the keys of each element in the sparsity pattern
+// of the linear system, so that it can be allocated once before assembling
+// (the keys are computed in parallel if parallel is set and if
+// space.getKeys() is thread-safe).
+template <class Iterator, class Assembler>
+void SparsityDofs(FunctionSpaceBase &space, Iterator itbegin, Iterator itend,
+                  Assembler &assembler, bool parallel = false)
+{
+  QuadratureVoid integrator;
+  AssembleByBlocks<int>(
+    itbegin, itend, integrator, parallel,
+    [&](MElement *e, int npts, IntPt *GP, int &local, std::vector<Dof> &R) {
+      space.getKeys(e, R);
+    },
+    [&](const int &local, std::vector<Dof> &R) { assembler.sparsityDof(R); });
+}
+
 template <class Iterator, class Assembler>
 void NumberDofs(FunctionSpaceBase &space, Iterator itbegin, Iterator itend,
                 Assembler &assembler)
 {
+  std::vector<Dof> R;
   for(Iterator it = itbegin; it != itend; ++it) {
     MElement *e = *it;
-    std::vector<Dof> R;
+    R.clear();
     space.getKeys(e, R);
-    int nbdofs = R.size();
-    for(int i = 0; i < nbdofs; ++i) assembler.numberDof(R[i]);
+    assembler.numberDof(R);
   }
 }
 